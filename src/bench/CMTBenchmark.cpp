@@ -0,0 +1,381 @@
+//
+// CMTBenchmark
+// MQSim
+//
+// Micro benchmark of the cached mapping table. The open addressing table in
+// use is driven side by side with a copy of the former unordered_map and
+// std::list based table, with the same key streams, and the throughput of
+// the lookup, insert and evict paths is reported for both.
+//
+//   CMTBenchmark [capacity] [operations]
+//
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../ssd/mapping/Address_Mapping_Unit_Page_Level.h"
+
+using namespace std;
+using namespace SSD_Components;
+
+namespace {
+  constexpr uint32_t DEFAULT_CAPACITY   = 256 * 1024;
+  constexpr uint64_t DEFAULT_OPERATIONS = 4 * 1024 * 1024;
+
+  constexpr stream_id_type STREAM_COUNT = 4;
+  constexpr uint32_t       KEY_SPACE_FACTOR = 4;
+  constexpr uint64_t       KEY_STREAM_SEED = 0x4d5153696dULL;
+
+  // ------------------------------------------------------------------------
+  // Cached mapping table implementation before the open addressing table.
+  // Kept verbatim (without debug messages) as the benchmark baseline.
+  // ------------------------------------------------------------------------
+  class LegacyCachedMappingTable {
+  private:
+    struct Slot {
+      PPA_type PPA;
+      unsigned long long WrittenStateBitmap;
+      bool Dirty;
+      CMTEntryStatus Status;
+      std::list<std::pair<LPA_type, Slot*>>::iterator listPtr;
+      stream_id_type Stream_id;
+    };
+
+    std::unordered_map<LPA_type, Slot*> addressMap;
+    std::list<std::pair<LPA_type, Slot*>> lruList;
+    uint32_t capacity;
+
+  public:
+    explicit LegacyCachedMappingTable(uint32_t capacity)
+      : capacity(capacity)
+    { }
+
+    ~LegacyCachedMappingTable()
+    {
+      for (auto& entry : addressMap)
+        delete entry.second;
+    }
+
+    bool Exists(const stream_id_type streamID, const LPA_type lpa)
+    {
+      auto it = addressMap.find(LPN_TO_UNIQUE_KEY(streamID, lpa));
+      return it != addressMap.end()
+             && it->second->Status == CMTEntryStatus::VALID;
+    }
+
+    PPA_type Retrieve_ppa(const stream_id_type streamID, const LPA_type lpa)
+    {
+      auto it = addressMap.find(LPN_TO_UNIQUE_KEY(streamID, lpa));
+      lruList.splice(lruList.begin(), lruList, it->second->listPtr);
+      return it->second->PPA;
+    }
+
+    void Insert_new_mapping_info(const stream_id_type streamID,
+                                 const LPA_type lpa,
+                                 const PPA_type ppa,
+                                 const unsigned long long pageWriteState)
+    {
+      auto it = addressMap.find(LPN_TO_UNIQUE_KEY(streamID, lpa));
+      if (it == addressMap.end())
+        throw std::logic_error("No slot is reserved!");
+
+      it->second->Status = CMTEntryStatus::VALID;
+      it->second->PPA = ppa;
+      it->second->WrittenStateBitmap = pageWriteState;
+      it->second->Dirty = false;
+      it->second->Stream_id = streamID;
+    }
+
+    bool Check_free_slot_availability()
+    {
+      return addressMap.size() < capacity;
+    }
+
+    void Reserve_slot_for_lpn(const stream_id_type streamID, const LPA_type lpa)
+    {
+      LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
+      if (addressMap.find(key) != addressMap.end())
+        throw std::logic_error("Duplicate lpa insertion into CMT!");
+      if (addressMap.size() >= capacity)
+        throw std::logic_error("CMT overfull!");
+
+      auto* cmtEnt = new Slot();
+      cmtEnt->Dirty = false;
+      cmtEnt->Stream_id = streamID;
+      lruList.push_front(std::pair<LPA_type, Slot*>(key, cmtEnt));
+      cmtEnt->Status = CMTEntryStatus::WAITING;
+      cmtEnt->listPtr = lruList.begin();
+      addressMap[key] = cmtEnt;
+    }
+
+    PPA_type Evict_one_slot(LPA_type& lpa)
+    {
+      addressMap.erase(lruList.back().first);
+      lpa = UNIQUE_KEY_TO_LPN(lruList.back().second->Stream_id,
+                              lruList.back().first);
+      Slot evictedItem = *lruList.back().second;
+      delete lruList.back().second;
+      lruList.pop_back();
+      return evictedItem.PPA;
+    }
+  };
+
+  struct Key {
+    stream_id_type stream;
+    LPA_type       lpa;
+  };
+
+  typedef std::vector<Key> KeyStream;
+
+  struct PhaseResult {
+    double   seconds;
+    uint64_t operations;
+    uint64_t checksum;
+  };
+
+  force_inline Key
+  __key_of(uint64_t index)
+  {
+    return Key{ stream_id_type(index % STREAM_COUNT), index / STREAM_COUNT };
+  }
+
+  // Keys [0, capacity) fill the table up, and the replacement keys follow
+  // them, so every replacement is a miss evicting the LRU entry.
+  KeyStream
+  __sequential_keys(uint64_t first, uint64_t count)
+  {
+    KeyStream keys;
+    keys.reserve(count);
+    for (uint64_t i = first; i < first + count; ++i)
+      keys.emplace_back(__key_of(i));
+
+    return keys;
+  }
+
+  KeyStream
+  __random_keys(std::mt19937_64& engine, uint64_t key_space, uint64_t count)
+  {
+    std::uniform_int_distribution<uint64_t> dist(0, key_space - 1);
+
+    KeyStream keys;
+    keys.reserve(count);
+    for (uint64_t i = 0; i < count; ++i)
+      keys.emplace_back(__key_of(dist(engine)));
+
+    return keys;
+  }
+
+  template <typename Fn>
+  force_inline PhaseResult
+  __measure(uint64_t operations, Fn&& fn)
+  {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t checksum = fn();
+    auto end = std::chrono::steady_clock::now();
+
+    return PhaseResult{ std::chrono::duration<double>(end - start).count(),
+                        operations,
+                        checksum };
+  }
+
+  template <typename Table>
+  struct Driver {
+    Table table;
+
+    explicit Driver(uint32_t capacity)
+      : table(capacity)
+    { }
+
+    // Reserve and fill the slots, as a translation read completes.
+    PhaseResult insert(const KeyStream& keys)
+    {
+      return __measure(keys.size(), [&]() {
+        uint64_t checksum = 0;
+        for (const auto& key : keys) {
+          table.Reserve_slot_for_lpn(key.stream, key.lpa);
+          table.Insert_new_mapping_info(key.stream, key.lpa, key.lpa, 0);
+          checksum += key.lpa;
+        }
+        return checksum;
+      });
+    }
+
+    // Hits only; each one moves the entry to the MRU position.
+    PhaseResult lookup(const KeyStream& keys)
+    {
+      return __measure(keys.size(), [&]() {
+        uint64_t checksum = 0;
+        for (const auto& key : keys)
+          if (table.Exists(key.stream, key.lpa))
+            checksum += table.Retrieve_ppa(key.stream, key.lpa);
+        return checksum;
+      });
+    }
+
+    // Misses only; each one evicts the LRU entry to take its slot.
+    PhaseResult evict(const KeyStream& keys)
+    {
+      return __measure(keys.size(), [&]() {
+        uint64_t checksum = 0;
+        for (const auto& key : keys) {
+          LPA_type evicted_lpa;
+          table.Evict_one_slot(evicted_lpa);
+          table.Reserve_slot_for_lpn(key.stream, key.lpa);
+          table.Insert_new_mapping_info(key.stream, key.lpa, key.lpa, 0);
+          checksum += evicted_lpa;
+        }
+        return checksum;
+      });
+    }
+
+    // Address translation path of the page level FTL on a random workload
+    // larger than the table.
+    PhaseResult mixed(const KeyStream& keys)
+    {
+      return __measure(keys.size(), [&]() {
+        uint64_t checksum = 0;
+        for (const auto& key : keys) {
+          if (table.Exists(key.stream, key.lpa)) {
+            checksum += table.Retrieve_ppa(key.stream, key.lpa);
+            continue;
+          }
+
+          if (!table.Check_free_slot_availability()) {
+            LPA_type evicted_lpa;
+            table.Evict_one_slot(evicted_lpa);
+            checksum += evicted_lpa << 1U;
+          }
+          table.Reserve_slot_for_lpn(key.stream, key.lpa);
+          table.Insert_new_mapping_info(key.stream, key.lpa, key.lpa, 0);
+        }
+        return checksum;
+      });
+    }
+  };
+
+  force_inline void
+  __print_header()
+  {
+    cout << left << setw(8) << "phase"
+         << setw(14) << "impl"
+         << right << setw(14) << "ops"
+         << setw(12) << "ns/op"
+         << setw(12) << "Mops/s"
+         << setw(10) << "speedup" << endl;
+  }
+
+  force_inline void
+  __print_row(const char* phase,
+              const char* impl,
+              const PhaseResult& result,
+              double baseline_seconds)
+  {
+    cout << left << setw(8) << phase
+         << setw(14) << impl
+         << right << setw(14) << result.operations
+         << fixed << setprecision(2)
+         << setw(12) << result.seconds * 1e9 / result.operations
+         << setw(12) << result.operations / result.seconds / 1e6
+         << setw(9) << baseline_seconds / result.seconds << 'x' << endl;
+  }
+
+  // The checksums also cross check that both tables hit, miss and evict the
+  // same entries for the same key stream.
+  bool
+  __report(const char* phase,
+           const PhaseResult& legacy,
+           const PhaseResult& current)
+  {
+    __print_row(phase, "legacy", legacy, legacy.seconds);
+    __print_row(phase, "open-address", current, legacy.seconds);
+
+    if (legacy.checksum == current.checksum)
+      return true;
+
+    cerr << "Checksum mismatch in the " << phase << " phase ("
+         << legacy.checksum << " != " << current.checksum << ")" << endl;
+    return false;
+  }
+
+  bool
+  __parse(const char* arg, uint64_t max, uint64_t& value)
+  {
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = strtoull(arg, &end, 10);
+
+    if (errno || end == arg || *end != '\0' || parsed == 0 || parsed > max
+        || arg[0] == '-')
+      return false;
+
+    value = parsed;
+    return true;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  uint64_t capacity = DEFAULT_CAPACITY;
+  uint64_t operations = DEFAULT_OPERATIONS;
+
+  if (argc > 3
+      || (argc > 1 && !__parse(argv[1], UINT32_MAX / 2, capacity))
+      || (argc > 2 && !__parse(argv[2], UINT64_MAX, operations))) {
+    cerr << "Usage: " << argv[0] << " [capacity] [operations]" << endl;
+    return 1;
+  }
+
+  std::mt19937_64 engine(KEY_STREAM_SEED);
+
+  KeyStream fill_keys = __sequential_keys(0, capacity);
+  KeyStream hit_keys = __random_keys(engine, capacity, operations);
+  KeyStream miss_keys = __sequential_keys(capacity, operations);
+  KeyStream mixed_keys = __random_keys(engine,
+                                       capacity * KEY_SPACE_FACTOR,
+                                       operations);
+
+  cout << "CMT capacity: " << capacity
+       << ", operations: " << operations
+       << ", streams: " << STREAM_COUNT << endl;
+  __print_header();
+
+  bool matched = true;
+
+  {
+    Driver<LegacyCachedMappingTable> legacy(static_cast<uint32_t>(capacity));
+    Driver<Cached_Mapping_Table> current(static_cast<uint32_t>(capacity));
+
+    PhaseResult legacy_insert = legacy.insert(fill_keys);
+    PhaseResult current_insert = current.insert(fill_keys);
+    matched &= __report("insert", legacy_insert, current_insert);
+
+    PhaseResult legacy_lookup = legacy.lookup(hit_keys);
+    PhaseResult current_lookup = current.lookup(hit_keys);
+    matched &= __report("lookup", legacy_lookup, current_lookup);
+
+    PhaseResult legacy_evict = legacy.evict(miss_keys);
+    PhaseResult current_evict = current.evict(miss_keys);
+    matched &= __report("evict", legacy_evict, current_evict);
+  }
+
+  {
+    Driver<LegacyCachedMappingTable> legacy(static_cast<uint32_t>(capacity));
+    Driver<Cached_Mapping_Table> current(static_cast<uint32_t>(capacity));
+
+    PhaseResult legacy_mixed = legacy.mixed(mixed_keys);
+    PhaseResult current_mixed = current.mixed(mixed_keys);
+    matched &= __report("mixed", legacy_mixed, current_mixed);
+  }
+
+  return matched ? 0 : 1;
+}
@@ -1,5 +1,7 @@
 #include "HostSystem.h"
 
+#include <fstream>
+
 #include "../ssd/interface/Host_Interface_NVMe.h"
 #include "../host/ioflow/IO_Flow_Synthetic.h"
 
@@ -113,7 +115,9 @@ HostSystem::Start_simulation()
   case HostInterface_Types::SATA: __init_sata_queue(); break;
   }
 
-  if (__ssd_device.preconditioning_required()) {
+  if (__ssd_device.checkpoint_restore_required()) {
+    __ssd_device.restore_checkpoint();
+  } else if (__ssd_device.preconditioning_required()) {
     auto workload_stats = __make_workloads_statistics();
     __ssd_device.perform_preconditioning(workload_stats);
   }
@@ -140,3 +144,23 @@ HostSystem::Report_results_in_XML(std::string /* name_prefix */,
 
   xmlwriter.Write_close_tag();
 }
+
+void
+HostSystem::Report_latency_in_CSV(const std::string& file_path)
+{
+  std::ofstream out(file_path);
+
+  if (!out.is_open())
+    throw mqsim_error("Cannot open the latency histogram file: " + file_path);
+
+  Host_Components::IoFlowStats all_flows;
+
+  Host_Components::IoFlowStats::Write_csv_header(out);
+
+  for (auto& flow : __io_flows) {
+    flow->stats().Report_results_in_CSV(flow->ID(), out);
+    all_flows.merge_latency(flow->stats());
+  }
+
+  all_flows.Report_results_in_CSV("All", out);
+}
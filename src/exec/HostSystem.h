@@ -44,6 +44,10 @@ public:
   void Report_results_in_XML(std::string name_prefix,
                              Utils::XmlWriter& xmlwriter) final;
 
+  // Writes the latency histograms of each flow, and of all flows merged, to
+  // a CSV file.
+  void Report_latency_in_CSV(const std::string& file_path);
+
   const Host_Components::IoFlowList& io_flows();
 
 };
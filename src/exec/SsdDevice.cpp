@@ -10,6 +10,8 @@
 #include "../ssd/gc_and_wl/GC_and_WL_Unit_Base.h"
 #include "../ssd/mapping/Address_Mapping_Unit_Base.h"
 #include "../ssd/tsu/TSU_Base.h"
+#include "../utils/Checkpoint.h"
+#include "../utils/Console.h"
 
 // To control NVMe and SATA interface
 #include "../ssd/interface/Host_Interface_NVMe.h"
@@ -28,6 +30,10 @@ SsdDevice::SsdDevice(const DeviceParameterSet& params,
     __ftl(ID() + ".FTL", params, __stats),
     __stats(params),
     __preconditioning_required(params.Enabled_Preconditioning),
+    __checkpoint_save_path(params.Checkpoint_Save_Path),
+    __checkpoint_restore_path(params.Checkpoint_Restore_Path),
+    __telemetry_sampling_period(params.Telemetry_Sampling_Period),
+    __telemetry(),
     lha_to_lpa_converter(this,
                          &SsdDevice::__convert_lha_to_lpa),
     nvm_access_bitmap_finder(this,
@@ -56,7 +62,7 @@ SsdDevice::SsdDevice(const DeviceParameterSet& params,
   Simulator->AddObject(&__ftl);
 
   // 4. Create and register TSU
-  auto tsu = build_tsu_object(params, __ftl, *__phy);
+  auto tsu = build_tsu_object(params, __ftl, *__phy, io_flows.size());
 
   __ftl.assign_tsu(tsu);
   Simulator->AddObject(tsu.get());
@@ -199,7 +205,7 @@ SsdDevice::perform_preconditioning(Utils::WorkloadStatsList& workload_stats)
   if (!__preconditioning_required)
     return;
 
-  std::cout << "SSD Device preconditioning started ........." << std::endl;
+  Utils::Console::out() << "SSD Device preconditioning started ........." << std::endl;
 
   time_t start_time = time(nullptr);
 
@@ -210,10 +216,60 @@ SsdDevice::perform_preconditioning(Utils::WorkloadStatsList& workload_stats)
 
   auto duration = (uint64_t)difftime(end_time, start_time);
 
-  std::cout << "Finished preconditioning. Duration of preconditioning: "
+  Utils::Console::out() << "Finished preconditioning. Duration of preconditioning: "
             << duration / 3600 << ":"
             << (duration % 3600) / 60 << ":"
             << ((duration % 3600) % 60) << std::endl;
+
+  if (!__checkpoint_save_path.empty())
+    __save_checkpoint();
+}
+
+void
+SsdDevice::__save_checkpoint() const
+{
+  // The data cache is not warmed up by the preconditioning, and there is no
+  // in-flight transaction before the simulation starts, so the FTL and the
+  // flash chips hold the whole device state.
+  Utils::CheckpointWriter writer(__checkpoint_save_path);
+
+  writer.write_section("SSD");
+  writer.write<uint32_t>(__channels.size());
+
+  for (auto& channel : __channels) {
+    writer.write<uint32_t>(channel.Chips.size());
+
+    for (auto& chip : channel.Chips)
+      chip.Save_checkpoint(writer);
+  }
+
+  __ftl.Save_checkpoint(writer);
+
+  writer.commit();
+
+  Utils::Console::out() << "Device checkpoint stored: " << __checkpoint_save_path
+            << std::endl;
+}
+
+void
+SsdDevice::restore_checkpoint()
+{
+  Utils::CheckpointReader reader(__checkpoint_restore_path);
+
+  reader.read_section("SSD");
+  reader.expect<uint32_t>(__channels.size(), "channels");
+
+  for (auto& channel : __channels) {
+    reader.expect<uint32_t>(channel.Chips.size(), "chips per channel");
+
+    for (auto& chip : channel.Chips)
+      chip.Load_checkpoint(reader);
+  }
+
+  __ftl.Load_checkpoint(reader);
+
+  Utils::Console::out() << "Device checkpoint restored: " << __checkpoint_restore_path
+            << std::endl;
 }
 
 void
@@ -232,3 +288,17 @@ SsdDevice::Report_results_in_XML(std::string /* name_prefix */,
 
   xmlwriter.Write_close_tag();
 }
+
+void
+SsdDevice::start_telemetry(const std::string& file_path)
+{
+  if (__telemetry_sampling_period == 0)
+    return;
+
+  __telemetry.reset(new SSD_Components::Telemetry(file_path,
+                                                  __telemetry_sampling_period,
+                                                  __ftl,
+                                                  *__cache_manager,
+                                                  __channels.size(),
+                                                  __channels[0].Chips.size()));
+}
@@ -8,6 +8,7 @@
 #include "../ssd/phy/NVM_PHY_ONFI.h"
 #include "../ssd/FTL.h"
 #include "../ssd/ONFI_Channel_Base.h"
+#include "../ssd/Telemetry.h"
 #include "../utils/Logical_Address_Partitioning_Unit.h"
 #include "../utils/Workload_Statistics.h"
 
@@ -48,6 +49,12 @@ private:
 
   const bool __preconditioning_required;
 
+  const std::string __checkpoint_save_path;
+  const std::string __checkpoint_restore_path;
+
+  const sim_time_type          __telemetry_sampling_period;
+  SSD_Components::TelemetryPtr __telemetry;
+
 public:
   const Utils::LhaToLpaConverter<SsdDevice>     lha_to_lpa_converter;
   const Utils::NvmAccessBitmapFinder<SsdDevice> nvm_access_bitmap_finder;
@@ -56,6 +63,8 @@ private:
   LPA_type __convert_lha_to_lpa(LHA_type lha) const;
   page_status_type __find_nvm_subunit_access_bitmap(LHA_type lha) const;
 
+  void __save_checkpoint() const;
+
 public:
   SsdDevice(const DeviceParameterSet& parameters,
              const IOFlowScenario& io_flows,
@@ -91,6 +100,14 @@ public:
   bool preconditioning_required() const;
   void perform_preconditioning(Utils::WorkloadStatsList& workload_stats);
 
+  // Restores the preconditioned device state instead of preconditioning
+  bool checkpoint_restore_required() const;
+  void restore_checkpoint();
+
+  // Samples the device internals into the file during the simulation, if
+  // the telemetry sampling period is set
+  void start_telemetry(const std::string& file_path);
+
 };
 
 force_inline uint32_t
@@ -117,4 +134,10 @@ SsdDevice::preconditioning_required() const
   return __preconditioning_required;
 }
 
+force_inline bool
+SsdDevice::checkpoint_restore_required() const
+{
+  return !__checkpoint_restore_path.empty();
+}
+
 #endif //!SSD_DEVICE_H
\ No newline at end of file
@@ -23,6 +23,7 @@ DeviceParameterSet::DeviceParameterSet()
     Queue_Fetch_Size(512),
     Caching_Mechanism(Caching_Mechanism::ADVANCED),
     Data_Cache_Sharing_Mode(Cache_Sharing_Mode::SHARED),
+    Data_Cache_Eviction_Policy(Cache_Eviction_Policy::LRU),
     Data_Cache_Capacity(1024 * 1024 * 512),
     Data_Cache_DRAM_Row_Size(8192),
     Data_Cache_DRAM_Data_Rate(800),
@@ -30,15 +31,26 @@ DeviceParameterSet::DeviceParameterSet()
     Data_Cache_DRAM_tRCD(13),
     Data_Cache_DRAM_tCL(13),
     Data_Cache_DRAM_tRP(13),
+    Data_Cache_Hot_Filter_Capacity(1048576),
+    Data_Cache_Hot_Filter_FP_Rate(0.01),
     Address_Mapping(Flash_Address_Mapping_Type::PAGE_LEVEL),
     Ideal_Mapping_Table(false),
     CMT_Capacity(2 * 1024 * 1024),
     CMT_Sharing_Mode(CMT_Sharing_Mode::SHARED),
+    GMT_Backing_Directory(),
+    Checkpoint_Save_Path(),
+    Checkpoint_Restore_Path(),
+    Telemetry_Sampling_Period(0),
     Plane_Allocation_Scheme(Flash_Plane_Allocation_Scheme_Type::CWDP),
     Transaction_Scheduling_Policy(Flash_Scheduling_Type::OUT_OF_ORDER),
+    FLIN_Flow_Classification_Epoch(10000000),
+    FLIN_Alpha_Read(32),
+    FLIN_Alpha_Write(32),
+    FLIN_Fairness_Threshold(0.6),
     Overprovisioning_Ratio(0.07),
     GC_Exec_Threshold(0.05),
     GC_Block_Selection_Policy(GC_Block_Selection_Policy_Type::RGA),
+    GC_Window_Size(0),
     Use_Copyback_for_GC(false),
     Preemptible_GC_Enabled(true),
     GC_Hard_Threshold(0.005),
@@ -73,6 +85,7 @@ DeviceParameterSet::XML_serialize(Utils::XmlWriter& xmlwriter) const
 
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Caching_Mechanism);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_Sharing_Mode);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_Eviction_Policy);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_Capacity);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_DRAM_Row_Size);
 
@@ -81,18 +94,29 @@ DeviceParameterSet::XML_serialize(Utils::XmlWriter& xmlwriter) const
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_DRAM_tRCD);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_DRAM_tCL);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_DRAM_tRP);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_Hot_Filter_Capacity);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Data_Cache_Hot_Filter_FP_Rate);
 
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Address_Mapping);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Use_Copyback_for_GC);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, CMT_Capacity);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, CMT_Sharing_Mode);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, GMT_Backing_Directory);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Checkpoint_Save_Path);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Checkpoint_Restore_Path);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Telemetry_Sampling_Period);
 
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Plane_Allocation_Scheme);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Transaction_Scheduling_Policy);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, FLIN_Flow_Classification_Epoch);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, FLIN_Alpha_Read);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, FLIN_Alpha_Write);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, FLIN_Fairness_Threshold);
 
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Overprovisioning_Ratio);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, GC_Exec_Threshold);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, GC_Block_Selection_Policy);
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, GC_Window_Size);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Use_Copyback_for_GC);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Preemptible_GC_Enabled);
   XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, GC_Hard_Threshold);
@@ -145,8 +169,11 @@ DeviceParameterSet::XML_deserialize(rapidxml::xml_node<> *node)
       else if (strcmp(param->name(), "Data_Cache_Sharing_Mode") == 0)
         Data_Cache_Sharing_Mode = to_cache_sharing_mode(param->value());
 
+      else if (strcmp(param->name(), "Data_Cache_Eviction_Policy") == 0)
+        Data_Cache_Eviction_Policy = to_cache_eviction_policy(param->value());
+
       else if (strcmp(param->name(), "Data_Cache_Capacity") == 0)
-        Data_Cache_Capacity = std::stoul(param->value());
+        Data_Cache_Capacity = std::stoull(param->value());
 
       else if (strcmp(param->name(), "Data_Cache_DRAM_Row_Size") == 0)
         Data_Cache_DRAM_Row_Size = std::stoul(param->value());
@@ -166,6 +193,12 @@ DeviceParameterSet::XML_deserialize(rapidxml::xml_node<> *node)
       else if (strcmp(param->name(), "Data_Cache_DRAM_tRP") == 0)
         Data_Cache_DRAM_tRP = std::stoul(param->value());
 
+      else if (strcmp(param->name(), "Data_Cache_Hot_Filter_Capacity") == 0)
+        Data_Cache_Hot_Filter_Capacity = std::stoull(param->value());
+
+      else if (strcmp(param->name(), "Data_Cache_Hot_Filter_FP_Rate") == 0)
+        Data_Cache_Hot_Filter_FP_Rate = std::stod(param->value());
+
       else if (strcmp(param->name(), "Address_Mapping") == 0)
         Address_Mapping = to_flash_addr_mapping(param->value());
 
@@ -178,12 +211,36 @@ DeviceParameterSet::XML_deserialize(rapidxml::xml_node<> *node)
       else if (strcmp(param->name(), "CMT_Sharing_Mode") == 0)
         CMT_Sharing_Mode = to_cmt_sharing_mode(param->value());
 
+      else if (strcmp(param->name(), "GMT_Backing_Directory") == 0)
+        GMT_Backing_Directory = param->value();
+
+      else if (strcmp(param->name(), "Checkpoint_Save_Path") == 0)
+        Checkpoint_Save_Path = param->value();
+
+      else if (strcmp(param->name(), "Checkpoint_Restore_Path") == 0)
+        Checkpoint_Restore_Path = param->value();
+
+      else if (strcmp(param->name(), "Telemetry_Sampling_Period") == 0)
+        Telemetry_Sampling_Period = std::stoull(param->value());
+
       else if (strcmp(param->name(), "Plane_Allocation_Scheme") == 0)
         Plane_Allocation_Scheme = to_flash_plane_alloc_scheme(param->value());
 
       else if (strcmp(param->name(), "Transaction_Scheduling_Policy") == 0)
         Transaction_Scheduling_Policy = to_scheduling_policy(param->value());
 
+      else if (strcmp(param->name(), "FLIN_Flow_Classification_Epoch") == 0)
+        FLIN_Flow_Classification_Epoch = std::stoull(param->value());
+
+      else if (strcmp(param->name(), "FLIN_Alpha_Read") == 0)
+        FLIN_Alpha_Read = std::stoul(param->value());
+
+      else if (strcmp(param->name(), "FLIN_Alpha_Write") == 0)
+        FLIN_Alpha_Write = std::stoul(param->value());
+
+      else if (strcmp(param->name(), "FLIN_Fairness_Threshold") == 0)
+        FLIN_Fairness_Threshold = std::stod(param->value());
+
       else if (strcmp(param->name(), "Overprovisioning_Ratio") == 0)
         Overprovisioning_Ratio = std::stod(param->value());
 
@@ -193,6 +250,9 @@ DeviceParameterSet::XML_deserialize(rapidxml::xml_node<> *node)
       else if (strcmp(param->name(), "GC_Block_Selection_Policy") == 0)
         GC_Block_Selection_Policy = to_gc_block_selection_policy(param->value());
 
+      else if (strcmp(param->name(), "GC_Window_Size") == 0)
+        GC_Window_Size = std::stoul(param->value());
+
       else if (strcmp(param->name(), "Use_Copyback_for_GC") == 0)
         Use_Copyback_for_GC = to_bool(param->value());
 
@@ -14,6 +14,12 @@
 #include "ParameterSetBase.h"
 
 class DeviceParameterSet : public ParameterSetBase {
+public:
+  // Number of seeds taken by gen_seed() while building an SSD device
+  // (FTL and GC/WL unit). Used to give each scenario the same seeds as the
+  // serial execution of the scenarios.
+  static constexpr int SEEDS_PER_DEVICE = 2;
+
 public:
   // Seed for random number generation
   // (used in device's random number generators)
@@ -33,8 +39,9 @@ public:
   // Data cache sharing among concurrently running I/O flows,
   // if NVMe host interface is used
   SSD_Components::Cache_Sharing_Mode Data_Cache_Sharing_Mode;
+  SSD_Components::Cache_Eviction_Policy Data_Cache_Eviction_Policy;
 
-  uint32_t Data_Cache_Capacity;       // bytes
+  uint64_t Data_Cache_Capacity;       // bytes
   uint32_t Data_Cache_DRAM_Row_Size;  // bytes
   uint32_t Data_Cache_DRAM_Data_Rate; // MT/s
 
@@ -48,6 +55,11 @@ public:
   sim_time_type Data_Cache_DRAM_tCL;
   sim_time_type Data_Cache_DRAM_tRP;
 
+  // Sizing of the counting Bloom filter which tells the recently written
+  // (hot) pages from the cold ones, whose writes are written back eagerly
+  uint64_t Data_Cache_Hot_Filter_Capacity;  // expected LPAs per second
+  double Data_Cache_Hot_Filter_FP_Rate;
+
   SSD_Components::Flash_Address_Mapping_Type Address_Mapping;
 
   // If mapping is ideal, then all the mapping entries are found in the DRAM
@@ -60,15 +72,43 @@ public:
 
   // How the entire CMT space is shared among concurrently running flows
   SSD_Components::CMT_Sharing_Mode CMT_Sharing_Mode;
+
+  // Directory to store the global mapping table in sparse memory mapped
+  // files. The table is kept in memory if it is empty.
+  std::string GMT_Backing_Directory;
+
+  // Checkpoint files of the preconditioned device. The device state is
+  // restored from Checkpoint_Restore_Path instead of preconditioning if it is
+  // set, and saved to Checkpoint_Save_Path after preconditioning.
+  std::string Checkpoint_Save_Path;
+  std::string Checkpoint_Restore_Path;
+
+  // Sampling period of the device telemetry in nano-seconds. Zero disables
+  // the telemetry.
+  sim_time_type Telemetry_Sampling_Period;
   SSD_Components::Flash_Plane_Allocation_Scheme_Type Plane_Allocation_Scheme;
   SSD_Components::Flash_Scheduling_Type Transaction_Scheduling_Policy;
 
+  // FLIN scheduler: the flows are reclassified at every epoch (in
+  // nano-seconds), and a flow is high intensity at a chip if more than alpha
+  // of its read/write transactions arrived at the chip during the last epoch.
+  // The queues are reordered when the min/max slowdown ratio drops below the
+  // fairness threshold.
+  sim_time_type FLIN_Flow_Classification_Epoch;
+  uint32_t FLIN_Alpha_Read;
+  uint32_t FLIN_Alpha_Write;
+  double FLIN_Fairness_Threshold;
+
   // The ratio of spare space with respect to the whole available storage space
   double Overprovisioning_Ratio;
 
   // The threshold for the ratio of free pages that used to trigger GC
   double GC_Exec_Threshold;
   SSD_Components::GC_Block_Selection_Policy_Type GC_Block_Selection_Policy;
+
+  // The number of least recently written blocks the WINDOWED_GREEDY policy
+  // chooses from. Zero uses log2 of the blocks per plane, same as RGA.
+  uint32_t GC_Window_Size;
   bool Use_Copyback_for_GC;
   bool Preemptible_GC_Enabled;
 
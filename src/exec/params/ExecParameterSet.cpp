@@ -20,7 +20,8 @@ ExecParameterSet::__dump_config_params(const std::string& file_path) const
 ExecParameterSet::ExecParameterSet(const std::string& ssd_config_path,
                                    const std::string& workload_defs_path)
   : Host_Configuration(workload_defs_path),
-    SSD_Device_Configuration()
+    SSD_Device_Configuration(),
+    Event_Queue_Type(MQSimEngine::Event_Queue_Type::CALENDAR)
 {
   load_config_params(ssd_config_path);
 }
@@ -78,6 +79,8 @@ ExecParameterSet::XML_serialize(Utils::XmlWriter& xmlwriter) const
 {
   xmlwriter.Write_open_tag("ExecParameterSet");
 
+  XML_WRITER_MACRO_WRITE_ATTR_STR(xmlwriter, Event_Queue_Type);
+
   Host_Configuration.XML_serialize(xmlwriter);
   SSD_Device_Configuration.XML_serialize(xmlwriter);
 
@@ -95,6 +98,8 @@ ExecParameterSet::XML_deserialize(rapidxml::xml_node<> *node)
       else if (strcmp(param->name(), "DeviceParameterSet") == 0)
         SSD_Device_Configuration.XML_deserialize(param);
 
+      else if (strcmp(param->name(), "Event_Queue_Type") == 0)
+        Event_Queue_Type = to_event_queue_type(param->value());
     }
   } catch (...) {
     throw mqsim_error("Error in the ExecParameterSet!");
@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include "../../sim/EventQueue.h"
+
 #include "DeviceParameterSet.h"
 #include "HostParameterSet.h"
 #include "IOFlowParamSet.h"
@@ -13,6 +15,9 @@ public:
   HostParameterSet   Host_Configuration;
   DeviceParameterSet SSD_Device_Configuration;
 
+  // Pending event set implementation of the simulation engine
+  MQSimEngine::Event_Queue_Type Event_Queue_Type;
+
 private:
   void __dump_config_params(const std::string& file_path) const;
 
@@ -23,6 +28,8 @@ public:
   void load_config_params(const std::string& file_path);
 
   std::string result_file_path(int scenario_no) const;
+  std::string latency_file_path(int scenario_no) const;
+  std::string telemetry_file_path(int scenario_no) const;
 
   void XML_serialize(Utils::XmlWriter& xmlwriter) const final;
   void XML_deserialize(rapidxml::xml_node<> *node) final;
@@ -35,4 +42,18 @@ ExecParameterSet::result_file_path(int scenario_no) const
            + "_scenario_" + std::to_string(scenario_no) + ".xml";
 }
 
+force_inline std::string
+ExecParameterSet::latency_file_path(int scenario_no) const
+{
+  return Host_Configuration.Input_file_path
+           + "_scenario_" + std::to_string(scenario_no) + "_latency.csv";
+}
+
+force_inline std::string
+ExecParameterSet::telemetry_file_path(int scenario_no) const
+{
+  return Host_Configuration.Input_file_path
+           + "_scenario_" + std::to_string(scenario_no) + "_telemetry.csv";
+}
+
 #endif
\ No newline at end of file
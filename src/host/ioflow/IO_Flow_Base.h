@@ -36,7 +36,7 @@ namespace Host_Components
 
     // If stop_time is zero, then the flow stops generating request when
     // the number of generated requests is equal to total_req_count
-    const uint32_t __max_req_count;
+    const uint64_t __max_req_count;
 
     // The initial amount of valid logical pages after preconditioning is
     // performed
@@ -86,7 +86,7 @@ namespace Host_Components
                                      uint32_t count,
                                      HostIOReqType type);
 
-    void _update_max_req_count(uint32_t max_req_count);
+    void _update_max_req_count(uint64_t max_req_count);
 
     bool _all_request_generated() const;
 
@@ -129,10 +129,12 @@ namespace Host_Components
                            const Utils::LhaToLpaConverterBase& convert_lha_to_lpa,
                            const Utils::NvmAccessBitmapFinderBase& find_nvm_subunit_access_bitmap);
 
-    uint32_t generated_requests() const;
-    uint32_t serviced_requests() const;
+    uint64_t generated_requests() const;
+    uint64_t serviced_requests() const;
     uint32_t average_response_time() const;     //in microseconds
     uint32_t average_end_to_end_delay() const;  //in microseconds
+
+    const IoFlowStats& stats() const;
   };
 
   force_inline IO_Flow_Priority_Class
@@ -153,9 +155,9 @@ namespace Host_Components
   }
 
   force_inline void
-  IO_Flow_Base::_update_max_req_count(uint32_t max_req_count)
+  IO_Flow_Base::_update_max_req_count(uint64_t max_req_count)
   {
-    const_cast<uint32_t&>(__max_req_count) = max_req_count;
+    const_cast<uint64_t&>(__max_req_count) = max_req_count;
   }
 
   force_inline bool
@@ -187,13 +189,13 @@ namespace Host_Components
     return __nvme_queue_info.cq_memory_base_address;
   }
 
-  force_inline uint32_t
+  force_inline uint64_t
   IO_Flow_Base::generated_requests() const
   {
     return __stats.generated_req();
   }
 
-  force_inline uint32_t
+  force_inline uint64_t
   IO_Flow_Base::serviced_requests() const
   {
     return __stats.serviced_req();
@@ -211,6 +213,12 @@ namespace Host_Components
     return __stats.avg_request_delay();
   }
 
+  force_inline const IoFlowStats&
+  IO_Flow_Base::stats() const
+  {
+    return __stats;
+  }
+
   // ---------------
   // IO Flow Builder
   // ---------------
@@ -3,6 +3,7 @@
 #include <cstdlib>
 
 #include "../../sim/Engine.h"
+#include "../../utils/Console.h"
 
 using namespace Host_Components;
 
@@ -10,10 +11,6 @@ using namespace Host_Components;
 /// TraceItem class
 /// ---------------
 
-/*
- * Trace format
- * <Time>| |<Device>| |<address>| |<size>| |<io type>
- */
 force_inline
 TraceItem::TraceItem()
   : __time(0),
@@ -23,44 +20,16 @@ TraceItem::TraceItem()
     __type(HostIOReqType::READ)
 { }
 
-force_inline bool
-TraceItem::check_valid(const char *string, int len)
-{
-  int delimiters = 0;
-  const char* end = string + len;
-
-  while (string < end) delimiters += (*(string++) == DELIMITER_CHAR) ? 1 : 0;
-
-  return delimiters == DELIMITER_COUNT;
-}
-
-force_inline bool
-TraceItem::parse(const char* line, char** end,
-                 sim_time_type offset_base,
-                 LHA_type start, LHA_type region_size)
-{
-  char* pos;
-
-  __time   = std::strtoull (line, &pos, 10) + offset_base;
-  __device = std::strtoul  (pos,  &pos, 10);
-  __lba    = std::strtoull (pos,  &pos, 10) % region_size + start;
-  __count  = std::strtoul  (pos,  &pos, 10);
-  __type   = *(pos + DELIMITER_LEN) == READ_CODE
-               ? HostIOReqType::READ
-               : HostIOReqType::WRITE;
-
-  if (end)
-    *end = pos + DELIMITER_LEN + 1;
-
-  return true;
-}
-
-force_inline bool
-TraceItem::parse(const std::string& str,
-                 sim_time_type offset_base,
-                 LHA_type start, LHA_type region_size)
+force_inline void
+TraceItem::load(const TraceRecord& record,
+                sim_time_type offset_base,
+                LHA_type start, LHA_type region_size)
 {
-  return parse(str.c_str(), nullptr, offset_base, start, region_size);
+  __time   = record.time + offset_base;
+  __device = record.device;
+  __lba    = record.lba % region_size + start;
+  __count  = record.count;
+  __type   = record.read ? HostIOReqType::READ : HostIOReqType::WRITE;
 }
 
 force_inline sim_time_type
@@ -119,11 +88,8 @@ IO_Flow_Trace_Based::IO_Flow_Trace_Based(const sim_object_id_type& name,
     __req_count_in_file(0),
     __time_offset(0),
     __item(),
-    __trc_stream(__trc_path, std::ios::in)
-{
-  if (!__trc_stream.is_open())
-    throw mqsim_error("Error while opening input trace file: " + __trc_path);
-}
+    __reader(build_trace_reader(__trc_path))
+{ }
 
 force_inline HostIORequest*
 IO_Flow_Trace_Based::__generate_next_req()
@@ -135,33 +101,18 @@ IO_Flow_Trace_Based::__generate_next_req()
                            __item.lba(), __item.lba_count(), __item.io_type());
 }
 
-force_inline uint32_t
+force_inline uint64_t
 IO_Flow_Trace_Based::__check_valid_requests()
 {
-  std::cout << "Investigating input trace file: " << __trc_path << std::endl;
-
-  std::string line;
-  uint32_t valid_reqs = 0;
-  sim_time_type now = 0;
-  sim_time_type last = 0;
-
-  while (std::getline(__trc_stream, line))
-  {
-    if (!TraceItem::check_valid(line.c_str(), line.size()))
-      break;
+  // Binary traces are validated by the converter, so skip the scan.
+  if (__reader->pre_validated())
+    return __reader->valid_records();
 
-    ++valid_reqs;
+  Utils::Console::out() << "Investigating input trace file: " << __trc_path << std::endl;
 
-    last = now;
-    now = std::strtoll(line.c_str(), nullptr, 10);
+  auto valid_reqs = __reader->valid_records();
 
-    if (now < last)
-      throw mqsim_error("Unexpected request arrival time: " + to_string(now) + "\n"
-                        "MQSim expects request arrival times to be "
-                        "monotonically increasing in the input trace!");
-  }
-
-  std::cout << "Trace file: " << __trc_path << " seems healthy" << std::endl;
+  Utils::Console::out() << "Trace file: " << __trc_path << " seems healthy" << std::endl;
 
   __move_to_begin();
 
@@ -171,18 +122,14 @@ IO_Flow_Trace_Based::__check_valid_requests()
 force_inline void
 IO_Flow_Trace_Based::__move_to_begin()
 {
-  __trc_stream.clear();
-  __trc_stream.seekg(0, std::ios::beg);
+  __reader->rewind();
   __req_count_in_file = 0;
 }
 
 force_inline void
 IO_Flow_Trace_Based::__load_item()
 {
-  std::string line;
-  std::getline(__trc_stream, line);
-
-  __item.parse(line, __time_offset, start_lsa, __flow_region_size);
+  __item.load(__reader->next(), __time_offset, start_lsa, __flow_region_size);
   ++__req_count_in_file;
 
   Simulator->Register_sim_event(__item.time(), this);
@@ -194,11 +141,11 @@ IO_Flow_Trace_Based::Start_simulation()
   IO_Flow_Base::Start_simulation();
 
   // 1. Check trace file healthy
-  const_cast<uint32_t&>(__max_reqs_in_file) = __check_valid_requests();
+  const_cast<uint64_t&>(__max_reqs_in_file) = __check_valid_requests();
 
   // 2. Update total max request
   _update_max_req_count(__max_replay == 1
-                          ? int(__load_percent / 100 * __max_reqs_in_file)
+                          ? uint64_t(__load_percent / 100 * __max_reqs_in_file)
                           : __max_reqs_in_file * __max_replay);
 
   // 3. Load item from file
@@ -225,7 +172,7 @@ IO_Flow_Trace_Based::Execute_simulator_event(MQSimEngine::SimEvent*)
     __move_to_begin();
     __time_offset = Simulator->Time();
 
-    std::cout << "* Replay round " << (__replay_count + 1)
+    Utils::Console::out() << "* Replay round " << (__replay_count + 1)
               << " of " << __max_replay << " started  for" << ID() << std::endl;
   }
 
@@ -253,23 +200,19 @@ IO_Flow_Trace_Based::get_stats(Utils::Workload_Statistics& stats,
   rd_sz_histo.resize(MAX_REQSIZE_HISTOGRAM_ITEMS + 1, 0);
   wr_sz_histo.resize(MAX_REQSIZE_HISTOGRAM_ITEMS + 1, 0);
 
-  uint32_t      total_lbas = 0;
-  uint32_t      total_reqs = 0;
+  uint64_t      total_lbas = 0;
+  uint64_t      total_reqs = 0;
   uint64_t      sum_request_size = 0;
   sim_time_type sum_arrival_interval = 0;
   sim_time_type last_arrival = 0;
 
-  std::ifstream trc_stream(__trc_path, std::ios::in);
+  TraceReader reader = build_trace_reader(__trc_path);
   TraceItem   item;
-  std::string line;
-
-  while (std::getline(trc_stream, line)) {
-    if (!TraceItem::check_valid(line.c_str(), line.size()))
-      break;
 
+  for (uint64_t i = 0, valid_reqs = reader->valid_records(); i < valid_reqs; ++i) {
     last_arrival = item.time();
 
-    item.parse(line, 0, start_lsa, __flow_region_size);
+    item.load(reader->next(), 0, start_lsa, __flow_region_size);
 
     /// 0. Check arrival time validation
     if (item.time() < last_arrival)
@@ -318,8 +261,6 @@ IO_Flow_Trace_Based::get_stats(Utils::Workload_Statistics& stats,
     ++total_reqs;
   }
 
-  trc_stream.close();
-
   stats.Type = Utils::Workload_Type::TRACE_BASED;
   stats.Total_generated_reqeusts = total_reqs;
   stats.Total_accessed_lbas = total_lbas;
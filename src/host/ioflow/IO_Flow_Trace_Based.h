@@ -3,9 +3,9 @@
 
 #include <string>
 #include <iostream>
-#include <fstream>
 
 #include "IO_Flow_Base.h"
+#include "TraceReader.h"
 
 namespace Host_Components
 {
@@ -13,13 +13,6 @@ namespace Host_Components
   /// TraceItem class
   /// ---------------
   class TraceItem {
-  private:
-    static constexpr char DELIMITER_COUNT = 4;
-    static constexpr char DELIMITER_CHAR = ' ';
-
-    static constexpr char READ_CODE = '1';
-    static constexpr int DELIMITER_LEN = 1;
-
   private:
     sim_time_type __time;
     uint32_t __device;
@@ -31,15 +24,9 @@ namespace Host_Components
     TraceItem();
     ~TraceItem() = default;
 
-    static bool check_valid(const char* string, int len);
-
-    bool parse(const char* str, char** end,
-               sim_time_type offset_base,
-               LHA_type start, LHA_type region_size);
-
-    bool parse(const std::string& str,
-               sim_time_type offset_base,
-               LHA_type start, LHA_type region_size);
+    void load(const TraceRecord& record,
+              sim_time_type offset_base,
+              LHA_type start, LHA_type region_size);
 
     sim_time_type time() const;
     LHA_type lba() const;
@@ -58,19 +45,19 @@ namespace Host_Components
     const std::string __trc_path;
     const double      __load_percent;
     const uint32_t    __max_replay;
-    const uint32_t    __max_reqs_in_file;
+    const uint64_t    __max_reqs_in_file;
 
     uint32_t      __replay_count;
-    uint32_t      __req_count_in_file;
+    uint64_t      __req_count_in_file;
 
     sim_time_type __time_offset;
     TraceItem     __item;
-    std::ifstream __trc_stream;
+    TraceReader   __reader;
 
   private:
     HostIORequest* __generate_next_req();
 
-    uint32_t __check_valid_requests();
+    uint64_t __check_valid_requests();
     void __move_to_begin();
     void __load_item();
 
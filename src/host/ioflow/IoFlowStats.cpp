@@ -13,8 +13,64 @@
 using namespace std;
 using namespace Host_Components;
 
+namespace {
+  constexpr uint32_t PERCENTILE_COUNT = 5;
+
+  constexpr double PERCENTILES[PERCENTILE_COUNT]
+    = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+
+  const char* const PERCENTILE_NAMES[PERCENTILE_COUNT]
+    = { "P50", "P90", "P99", "P99_9", "P99_99" };
+
+  const char* const ALL_SIZE_CLASSES = "All";
+}
+
+string
+IoFlowStats::size_class_name(uint32_t size_class)
+{
+  static const char* const names[SIZE_CLASS_COUNT]
+    = { "4KiB", "16KiB", "64KiB", "256KiB", "Over_256KiB" };
+
+  return names[size_class];
+}
+
+// Visits the non empty histograms, the whole read and write response time
+// first and then their size classes, as (metric, type, size class, histogram).
+template <typename Visitor>
 void
-IoFlowStats::Report_results_in_XML(string /* name_prefix */,
+IoFlowStats::__for_each_histogram(Visitor&& visit) const
+{
+  static const string response_time = "Device_Response_Time";
+  static const string req_delay = "End_to_End_Request_Delay";
+
+  const HostIOReqType types[] = { HostIOReqType::READ, HostIOReqType::WRITE };
+
+  for (auto type : types) {
+    const string type_name = type == HostIOReqType::READ ? "Read" : "Write";
+    auto& histograms = type == HostIOReqType::READ ? __dev_rd_response_time
+                                                   : __dev_wr_response_time;
+
+    auto merged = __dev_response_time(type);
+
+    if (!merged.count())
+      continue;
+
+    visit(response_time, type_name, string(ALL_SIZE_CLASSES), merged);
+
+    for (uint32_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+      if (histograms[i].count())
+        visit(response_time, type_name, size_class_name(i), histograms[i]);
+  }
+
+  if (__rd_req_delay.count())
+    visit(req_delay, string("Read"), string(ALL_SIZE_CLASSES), __rd_req_delay);
+
+  if (__wr_req_delay.count())
+    visit(req_delay, string("Write"), string(ALL_SIZE_CLASSES), __wr_req_delay);
+}
+
+void
+IoFlowStats::Report_results_in_XML(string name_prefix,
                                    Utils::XmlWriter& writer)
 {
   double seconds = Simulator->seconds();
@@ -59,7 +115,8 @@ IoFlowStats::Report_results_in_XML(string /* name_prefix */,
                                 __transferred_writes.bandwidth(seconds));
 
   // 3. Response time
-  auto dev_resp  = __dev_rd_response_time + __dev_wr_response_time;
+  auto dev_resp  = __dev_response_time(HostIOReqType::READ)
+                    + __dev_response_time(HostIOReqType::WRITE);
 
   writer.Write_attribute_string("Device_Response_Time",
                                 dev_resp.avg(NSEC_TO_USEC_COEFF));
@@ -70,6 +127,12 @@ IoFlowStats::Report_results_in_XML(string /* name_prefix */,
   writer.Write_attribute_string("Max_Device_Response_Time",
                                 dev_resp.max(NSEC_TO_USEC_COEFF));
 
+  for (uint32_t i = 0; i < PERCENTILE_COUNT; ++i)
+    writer.Write_attribute_string(string("Device_Response_Time_")
+                                    + PERCENTILE_NAMES[i],
+                                  dev_resp.percentile(PERCENTILES[i],
+                                                      NSEC_TO_USEC_COEFF));
+
   // 4. Request delay time
   auto req_delay = __rd_req_delay + __wr_req_delay;
   writer.Write_attribute_string("End_to_End_Request_Delay",
@@ -81,4 +144,70 @@ IoFlowStats::Report_results_in_XML(string /* name_prefix */,
   writer.Write_attribute_string("Max_End_to_End_Request_Delay",
                                 req_delay.max(NSEC_TO_USEC_COEFF));
 
+  for (uint32_t i = 0; i < PERCENTILE_COUNT; ++i)
+    writer.Write_attribute_string(string("End_to_End_Request_Delay_")
+                                    + PERCENTILE_NAMES[i],
+                                  req_delay.percentile(PERCENTILES[i],
+                                                       NSEC_TO_USEC_COEFF));
+
+  // 5. Latency histograms
+  __for_each_histogram([&](const string& metric,
+                           const string& type,
+                           const string& size_class,
+                           const Utils::LatencyHistogram& histogram) {
+    writer.Write_start_element_tag(name_prefix + ".IO_Flow.Latency");
+
+    writer.Write_attribute_string_inline("Metric", metric);
+    writer.Write_attribute_string_inline("Type", type);
+    writer.Write_attribute_string_inline("Size_Class", size_class);
+    writer.Write_attribute_string_inline("Request_Count", histogram.count());
+
+    writer.Write_attribute_string_inline("Min",
+                                         histogram.min(NSEC_TO_USEC_COEFF));
+    writer.Write_attribute_string_inline("Average",
+                                         histogram.avg(NSEC_TO_USEC_COEFF));
+
+    for (uint32_t i = 0; i < PERCENTILE_COUNT; ++i)
+      writer.Write_attribute_string_inline(PERCENTILE_NAMES[i],
+                                           histogram.percentile(PERCENTILES[i],
+                                                                NSEC_TO_USEC_COEFF));
+
+    writer.Write_attribute_string_inline("Max",
+                                         histogram.max(NSEC_TO_USEC_COEFF));
+    writer.Write_attribute_string_inline("Histogram_ns", histogram.to_string());
+
+    writer.Write_end_element_tag();
+  });
+}
+
+void
+IoFlowStats::Write_csv_header(ostream& out)
+{
+  out << "Flow,Metric,Type,Size_Class,Request_Count,Min,Average";
+
+  for (auto name : PERCENTILE_NAMES)
+    out << ',' << name;
+
+  out << ",Max,Histogram_ns" << '\n';
+}
+
+void
+IoFlowStats::Report_results_in_CSV(const string& flow_name,
+                                   ostream& out) const
+{
+  __for_each_histogram([&](const string& metric,
+                           const string& type,
+                           const string& size_class,
+                           const Utils::LatencyHistogram& histogram) {
+    out << flow_name << ',' << metric << ',' << type << ',' << size_class
+        << ',' << histogram.count()
+        << ',' << histogram.min(NSEC_TO_USEC_COEFF)
+        << ',' << histogram.avg(NSEC_TO_USEC_COEFF);
+
+    for (auto percentile : PERCENTILES)
+      out << ',' << histogram.percentile(percentile, NSEC_TO_USEC_COEFF);
+
+    out << ',' << histogram.max(NSEC_TO_USEC_COEFF)
+        << ',' << histogram.to_string() << '\n';
+  });
 }
\ No newline at end of file
@@ -10,20 +10,27 @@
 #define __MQSim__IOFlowStats__
 
 #include <cstdint>
+#include <ostream>
 #include <string>
 
 #include "../../sim/Sim_Defs.h"
 #include "../../sim/Sim_Reporter.h"
 #include "../../utils/CountingStats.h"
+#include "../../utils/LatencyHistogram.h"
 
 #include "HostIORequest.h"
 
 namespace Host_Components {
   class IoFlowStats : public MQSimEngine::Sim_Reporter {
+  public:
+    // Request size classes of the response time histograms. Each class
+    // holds the requests up to its size, and the last one the larger ones.
+    static constexpr uint32_t SIZE_CLASS_COUNT = 5;
+
   private:
     //Variables used to collect statistics
-    uint32_t __generated_req;
-    uint32_t __serviced_req;
+    uint64_t __generated_req;
+    uint64_t __serviced_req;
 
     Utils::IopsStats __generated_reads;
     Utils::IopsStats __generated_writes;
@@ -35,30 +42,49 @@ namespace Host_Components {
     Utils::IopsStats __serviced_reads;
     Utils::IopsStats __serviced_writes;
 
-    Utils::MinMaxAvgStats<sim_time_type> __dev_rd_response_time;
-    Utils::MinMaxAvgStats<sim_time_type> __dev_wr_response_time;
-    Utils::MinMaxAvgStats<sim_time_type> __rd_req_delay;
-    Utils::MinMaxAvgStats<sim_time_type> __wr_req_delay;
+    Utils::LatencyHistogram __dev_rd_response_time[SIZE_CLASS_COUNT];
+    Utils::LatencyHistogram __dev_wr_response_time[SIZE_CLASS_COUNT];
+    Utils::LatencyHistogram __rd_req_delay;
+    Utils::LatencyHistogram __wr_req_delay;
 
     Utils::BandwidthStats<sim_time_type> __transferred_reads;
     Utils::BandwidthStats<sim_time_type> __transferred_writes;
 
+    Utils::LatencyHistogram __dev_response_time(HostIOReqType type) const;
+
+    template <typename Visitor>
+    void __for_each_histogram(Visitor&& visit) const;
+
   public:
     IoFlowStats();
 
+    static uint32_t size_class(uint32_t size_in_byte);
+    static std::string size_class_name(uint32_t size_class);
+
     void update_response(const HostIORequest* request,
                          sim_time_type dev_response,
                          sim_time_type req_delay);
 
     void update_generate(Host_Components::HostIOReqType type);
 
-    uint32_t generated_req() const;
-    uint32_t serviced_req() const;
+    uint64_t generated_req() const;
+    uint64_t serviced_req() const;
     uint32_t avg_response_time() const;
     uint32_t avg_request_delay() const;
+    uint32_t response_time_percentile(double percentile) const;
+
+    // Merges the latency histograms of the other flow, i.e. to report the
+    // latency of all flows together.
+    void merge_latency(const IoFlowStats& rhs);
 
     void Report_results_in_XML(std::string name_prefix,
                                Utils::XmlWriter& writer) final;
+
+    // One CSV row per non empty histogram. Times are in microseconds, and
+    // the histogram buckets are in nanoseconds.
+    static void Write_csv_header(std::ostream& out);
+    void Report_results_in_CSV(const std::string& flow_name,
+                               std::ostream& out) const;
   };
 
   force_inline
@@ -69,14 +95,44 @@ namespace Host_Components {
       __generated_writes(),
       __serviced_reads(),
       __serviced_writes(),
-      __dev_rd_response_time(MAXIMUM_TIME, 0),
-      __dev_wr_response_time(MAXIMUM_TIME, 0),
-      __rd_req_delay(MAXIMUM_TIME, 0),
-      __wr_req_delay(MAXIMUM_TIME, 0),
+      __dev_rd_response_time(),
+      __dev_wr_response_time(),
+      __rd_req_delay(),
+      __wr_req_delay(),
       __transferred_reads(),
       __transferred_writes()
   { }
 
+  force_inline uint32_t
+  IoFlowStats::size_class(uint32_t size_in_byte)
+  {
+    // 4KiB, 16KiB, 64KiB and 256KiB
+    static constexpr uint32_t bounds[SIZE_CLASS_COUNT - 1]
+      = { 4096, 16384, 65536, 262144 };
+
+    uint32_t size_class = 0;
+
+    while (size_class < SIZE_CLASS_COUNT - 1
+             && bounds[size_class] < size_in_byte)
+      ++size_class;
+
+    return size_class;
+  }
+
+  force_inline Utils::LatencyHistogram
+  IoFlowStats::__dev_response_time(HostIOReqType type) const
+  {
+    auto& histograms = type == HostIOReqType::READ ? __dev_rd_response_time
+                                                   : __dev_wr_response_time;
+
+    Utils::LatencyHistogram merged;
+
+    for (auto& histogram : histograms)
+      merged += histogram;
+
+    return merged;
+  }
+
   force_inline void
   IoFlowStats::update_response(const HostIORequest *request,
                                sim_time_type dev_response,
@@ -86,12 +142,14 @@ namespace Host_Components {
 
     if (request->Type == HostIOReqType::READ) {
       ++__serviced_reads;
-      __dev_rd_response_time += dev_response;
+      __dev_rd_response_time[size_class(request->requested_size())]
+        += dev_response;
       __rd_req_delay += req_delay;
       __transferred_reads += request->requested_size();
     } else {
       ++__serviced_writes;
-      __dev_wr_response_time += dev_response;
+      __dev_wr_response_time[size_class(request->requested_size())]
+        += dev_response;
       __wr_req_delay += req_delay;
       __transferred_writes += request->requested_size();
     }
@@ -108,18 +166,19 @@ namespace Host_Components {
       ++__generated_reads;
   }
 
-  force_inline uint32_t
+  force_inline uint64_t
   IoFlowStats::generated_req() const
   { return __generated_req; }
 
-  force_inline uint32_t
+  force_inline uint64_t
   IoFlowStats::serviced_req() const
   { return __serviced_req; }
 
   force_inline uint32_t
   IoFlowStats::avg_response_time() const
   {
-    auto response_time = __dev_rd_response_time + __dev_wr_response_time;
+    auto response_time = __dev_response_time(HostIOReqType::READ)
+                           + __dev_response_time(HostIOReqType::WRITE);
 
     return response_time.avg(SIM_TIME_TO_MICROSECONDS_COEFF);
   }
@@ -132,6 +191,28 @@ namespace Host_Components {
     return req_delay.avg(SIM_TIME_TO_MICROSECONDS_COEFF);
   }
 
+  force_inline uint32_t
+  IoFlowStats::response_time_percentile(double percentile) const
+  {
+    auto response_time = __dev_response_time(HostIOReqType::READ)
+                           + __dev_response_time(HostIOReqType::WRITE);
+
+    return response_time.percentile(percentile,
+                                    SIM_TIME_TO_MICROSECONDS_COEFF);
+  }
+
+  force_inline void
+  IoFlowStats::merge_latency(const IoFlowStats& rhs)
+  {
+    for (uint32_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+      __dev_rd_response_time[i] += rhs.__dev_rd_response_time[i];
+      __dev_wr_response_time[i] += rhs.__dev_wr_response_time[i];
+    }
+
+    __rd_req_delay += rhs.__rd_req_delay;
+    __wr_req_delay += rhs.__wr_req_delay;
+  }
+
 }
 
 #endif /* Predefined include guard __MQSim__IOFlowStats__ */
@@ -10,6 +10,8 @@
 
 #include <cmath>
 
+#include "../../utils/Console.h"
+
 using namespace Host_Components;
 
 /// =========================
@@ -159,7 +161,7 @@ StreamDistributor::generate(uint32_t lba_count)
     __next_address = _align_address(__next_address) + _align_unit;
 
   if(__next_address == lba)
-    std::cout << "Synthetic Message Generator: The same address is always "
+    Utils::Console::out() << "Synthetic Message Generator: The same address is always "
                  "repeated due to configuration parameters!" << std::endl;
 
   return _align_address(lba);
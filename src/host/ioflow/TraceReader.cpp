@@ -0,0 +1,319 @@
+#include "TraceReader.h"
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "../../utils/Exception.h"
+
+using namespace Host_Components;
+
+constexpr char BinaryTraceHeader::MAGIC[8];
+constexpr uint32_t BinaryTraceHeader::VERSION;
+constexpr uint32_t BinaryTraceHeader::MONOTONIC_TIME;
+
+/// ---------------------
+/// ASCII parsing helpers
+/// ---------------------
+namespace {
+  constexpr char DELIMITER_CHAR = ' ';
+  constexpr int  DELIMITER_COUNT = 4;
+  constexpr char READ_CODE = '1';
+  constexpr int  DELIMITER_LEN = 1;
+
+  force_inline const char*
+  __line_end(const char* pos, const char* end)
+  {
+    auto eol = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+
+    return eol ? eol : end;
+  }
+
+  force_inline bool
+  __check_valid(const char* pos, const char* eol)
+  {
+    int delimiters = 0;
+
+    while (pos < eol) delimiters += (*(pos++) == DELIMITER_CHAR) ? 1 : 0;
+
+    return delimiters == DELIMITER_COUNT;
+  }
+
+  // Same as strtoull(), but never reads beyond the end of the line because
+  // the mapped file is not null terminated.
+  force_inline uint64_t
+  __parse_uint(const char*& pos, const char* eol)
+  {
+    while (pos < eol && std::isspace(*pos)) ++pos;
+
+    uint64_t value = 0;
+
+    while (pos < eol && '0' <= *pos && *pos <= '9')
+      value = value * 10 + uint64_t(*(pos++) - '0');
+
+    return value;
+  }
+
+  // Narrows a parsed field into the record, and rejects the values which do
+  // not fit instead of silently truncating them.
+  template <typename T>
+  force_inline T
+  __narrow(uint64_t value, const char* field)
+  {
+    if (std::numeric_limits<T>::max() < value)
+      throw mqsim_error(std::string("Out of range ") + field
+                        + " in the input trace: " + std::to_string(value));
+
+    return T(value);
+  }
+
+  force_inline void
+  __parse_record(TraceRecord& record, const char* pos, const char* eol)
+  {
+    record.time   = __parse_uint(pos, eol);
+    record.device = __narrow<uint16_t>(__parse_uint(pos, eol), "device number");
+    record.lba    = __parse_uint(pos, eol);
+    record.count  = __narrow<uint32_t>(__parse_uint(pos, eol), "request size");
+    record.read   = (pos + DELIMITER_LEN < eol
+                       && *(pos + DELIMITER_LEN) == READ_CODE) ? 1 : 0;
+  }
+
+  force_inline mqsim_error
+  __non_monotonic_error(uint64_t time)
+  {
+    return mqsim_error("Unexpected request arrival time: "
+                       + std::to_string(time) + "\n"
+                       "MQSim expects request arrival times to be "
+                       "monotonically increasing in the input trace!");
+  }
+}
+
+/// ---------------------
+/// Trace reader interface
+/// ---------------------
+TraceReaderBase::TraceReaderBase(const std::string& path)
+  : _path(path),
+    _file()
+{
+  if (!_file.open(_path))
+    throw mqsim_error("Error while opening input trace file: " + _path);
+
+  _file.advise_sequential();
+}
+
+/// ------------------
+/// ASCII trace reader
+/// ------------------
+AsciiTraceReader::AsciiTraceReader(const std::string& path)
+  : TraceReaderBase(path),
+    __pos(_file.begin()),
+    __valid_records(0),
+    __parsed_records(0),
+    __validated(false),
+    __batch(),
+    __batch_pos(0)
+{
+  __batch.reserve(BATCH_SIZE);
+}
+
+uint64_t
+AsciiTraceReader::valid_records()
+{
+  if (__validated)
+    return __valid_records;
+
+  const char* end = _file.end();
+  uint64_t now = 0;
+  uint64_t last = 0;
+
+  for (const char* pos = _file.begin(); pos < end; ) {
+    const char* eol = __line_end(pos, end);
+
+    if (!__check_valid(pos, eol))
+      break;
+
+    ++__valid_records;
+
+    last = now;
+    now = __parse_uint(pos, eol);
+
+    if (now < last)
+      throw __non_monotonic_error(now);
+
+    pos = eol + 1;
+  }
+
+  __validated = true;
+
+  return __valid_records;
+}
+
+bool
+AsciiTraceReader::pre_validated() const
+{
+  return false;
+}
+
+void
+AsciiTraceReader::__fill_batch()
+{
+  const char* end = _file.end();
+  uint64_t valid = valid_records();
+
+  __batch.clear();
+  __batch_pos = 0;
+
+  while (__batch.size() < BATCH_SIZE && __parsed_records < valid) {
+    const char* eol = __line_end(__pos, end);
+
+    __batch.emplace_back();
+    __parse_record(__batch.back(), __pos, eol);
+
+    ++__parsed_records;
+
+    __pos = (eol < end) ? eol + 1 : end;
+  }
+
+  if (__batch.empty())
+    throw mqsim_error("No more valid requests in the input trace file: "
+                      + _path);
+}
+
+void
+AsciiTraceReader::rewind()
+{
+  __pos = _file.begin();
+  __parsed_records = 0;
+
+  __batch.clear();
+  __batch_pos = 0;
+}
+
+const TraceRecord&
+AsciiTraceReader::next()
+{
+  if (__batch_pos == __batch.size())
+    __fill_batch();
+
+  return __batch[__batch_pos++];
+}
+
+/// -------------------
+/// Binary trace reader
+/// -------------------
+BinaryTraceReader::BinaryTraceReader(const std::string& path)
+  : TraceReaderBase(path),
+    __records(nullptr),
+    __record_count(0),
+    __pos(0)
+{
+  BinaryTraceHeader header{};
+
+  if (_file.size() < sizeof(header))
+    throw mqsim_error("Invalid binary trace file: " + _path);
+
+  std::memcpy(&header, _file.begin(), sizeof(header));
+
+  if (std::memcmp(header.magic, BinaryTraceHeader::MAGIC, sizeof(header.magic))
+      || header.version != BinaryTraceHeader::VERSION
+      || header.record_size != sizeof(TraceRecord))
+    throw mqsim_error("Unsupported binary trace file: " + _path);
+
+  if (!(header.flags & BinaryTraceHeader::MONOTONIC_TIME))
+    throw mqsim_error("MQSim expects request arrival times to be "
+                      "monotonically increasing in the input trace: " + _path);
+
+  if ((_file.size() - sizeof(header)) / sizeof(TraceRecord) < header.record_count)
+    throw mqsim_error("Truncated binary trace file: " + _path);
+
+  __records = reinterpret_cast<const TraceRecord*>(_file.begin() + sizeof(header));
+  __record_count = header.record_count;
+}
+
+uint64_t
+BinaryTraceReader::valid_records()
+{
+  return __record_count;
+}
+
+bool
+BinaryTraceReader::pre_validated() const
+{
+  return true;
+}
+
+void
+BinaryTraceReader::rewind()
+{
+  __pos = 0;
+}
+
+const TraceRecord&
+BinaryTraceReader::next()
+{
+  if (__record_count <= __pos)
+    throw mqsim_error("No more valid requests in the input trace file: "
+                      + _path);
+
+  return __records[__pos++];
+}
+
+/// ---------------------
+/// Trace reader builder
+/// ---------------------
+TraceReader
+Host_Components::build_trace_reader(const std::string& path)
+{
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+
+  if (!file.is_open())
+    throw mqsim_error("Error while opening input trace file: " + path);
+
+  char magic[sizeof(BinaryTraceHeader::MAGIC)] = {};
+  file.read(magic, sizeof(magic));
+
+  if (file.gcount() == sizeof(magic)
+      && std::memcmp(magic, BinaryTraceHeader::MAGIC, sizeof(magic)) == 0)
+    return std::make_shared<BinaryTraceReader>(path);
+
+  return std::make_shared<AsciiTraceReader>(path);
+}
+
+uint64_t
+Host_Components::convert_trace_to_binary(const std::string& ascii_path,
+                                         const std::string& binary_path)
+{
+  AsciiTraceReader reader(ascii_path);
+
+  // Throws if the arrival times are not monotonically increasing.
+  uint64_t records = reader.valid_records();
+
+  std::ofstream file(binary_path,
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!file.is_open())
+    throw mqsim_error("Error while opening output trace file: " + binary_path);
+
+  BinaryTraceHeader header{};
+
+  std::memcpy(header.magic, BinaryTraceHeader::MAGIC, sizeof(header.magic));
+  header.version = BinaryTraceHeader::VERSION;
+  header.record_size = sizeof(TraceRecord);
+  header.record_count = records;
+  header.flags = BinaryTraceHeader::MONOTONIC_TIME;
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  for (uint64_t i = 0; i < records; ++i)
+    file.write(reinterpret_cast<const char*>(&reader.next()),
+               sizeof(TraceRecord));
+
+  file.close();
+
+  if (!file)
+    throw mqsim_error("Error while writing output trace file: " + binary_path);
+
+  return records;
+}
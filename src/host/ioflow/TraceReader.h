@@ -0,0 +1,162 @@
+//
+// TraceReader
+// MQSim
+//
+
+#ifndef __MQSim__TraceReader__
+#define __MQSim__TraceReader__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../utils/InlineTools.h"
+#include "../../utils/MappedFile.h"
+
+namespace Host_Components {
+  /// ------------------------------------------------------------------------
+  /// Raw trace record
+  ///
+  /// Values are stored as written in the trace file. Time offset and address
+  /// region mapping are applied by the IO flow which replays the record.
+  /// This is also the record layout of the binary trace format.
+  /// ------------------------------------------------------------------------
+  struct TraceRecord {
+    uint64_t time;
+    uint64_t lba;
+    uint32_t count;
+    uint16_t device;
+    uint8_t  read;
+    uint8_t  reserved;
+  };
+
+  static_assert(sizeof(TraceRecord) == 24, "Unexpected trace record size");
+
+  /// ------------------------------------------------------------------------
+  /// Binary trace file header
+  ///
+  /// The header is written by the trace converter after the whole trace has
+  /// been validated, so the reader can use the record count without scanning
+  /// the file. Multi-byte fields are stored in the host byte order.
+  /// ------------------------------------------------------------------------
+  struct BinaryTraceHeader {
+    static constexpr char     MAGIC[8] = {'M', 'Q', 'S', 'I', 'M', 'T', 'R', 'C'};
+    static constexpr uint32_t VERSION = 1;
+
+    // The arrival times of all records are monotonically increasing.
+    static constexpr uint32_t MONOTONIC_TIME = 0x1;
+
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t record_count;
+    uint32_t flags;
+    uint32_t reserved;
+  };
+
+  static_assert(sizeof(BinaryTraceHeader) == 32,
+                "Unexpected binary trace header size");
+
+  /// ------------------------------------------------------------------------
+  /// Trace reader interface
+  /// ------------------------------------------------------------------------
+  class TraceReaderBase {
+  protected:
+    const std::string _path;
+    Utils::MappedFile _file;
+
+  public:
+    explicit TraceReaderBase(const std::string& path);
+    virtual ~TraceReaderBase() = default;
+
+    const std::string& path() const;
+
+    // Number of valid records from the beginning of the trace. Reading is
+    // allowed only within this count.
+    virtual uint64_t valid_records() = 0;
+
+    // True if the valid records are already checked without scanning.
+    virtual bool pre_validated() const = 0;
+
+    virtual void rewind() = 0;
+    virtual const TraceRecord& next() = 0;
+  };
+
+  typedef std::shared_ptr<TraceReaderBase> TraceReader;
+
+  force_inline const std::string&
+  TraceReaderBase::path() const
+  {
+    return _path;
+  }
+
+  /// ------------------------------------------------------------------------
+  /// ASCII trace reader
+  ///
+  /// Trace format (one request per line):
+  ///   <Time>| |<Device>| |<address>| |<size>| |<io type>
+  ///
+  /// Lines are parsed ahead in batches directly from the mapped file, so
+  /// there is no per-line string allocation.
+  /// ------------------------------------------------------------------------
+  class AsciiTraceReader : public TraceReaderBase {
+  private:
+    static constexpr size_t BATCH_SIZE = 4096;
+
+  private:
+    const char* __pos;
+
+    uint64_t __valid_records;
+    uint64_t __parsed_records;
+    bool     __validated;
+
+    std::vector<TraceRecord> __batch;
+    size_t __batch_pos;
+
+  private:
+    void __fill_batch();
+
+  public:
+    explicit AsciiTraceReader(const std::string& path);
+    ~AsciiTraceReader() final = default;
+
+    uint64_t valid_records() final;
+    bool pre_validated() const final;
+
+    void rewind() final;
+    const TraceRecord& next() final;
+  };
+
+  /// ------------------------------------------------------------------------
+  /// Binary trace reader
+  ///
+  /// Records are read in place from the mapped file.
+  /// ------------------------------------------------------------------------
+  class BinaryTraceReader : public TraceReaderBase {
+  private:
+    const TraceRecord* __records;
+    uint64_t __record_count;
+    uint64_t __pos;
+
+  public:
+    explicit BinaryTraceReader(const std::string& path);
+    ~BinaryTraceReader() final = default;
+
+    uint64_t valid_records() final;
+    bool pre_validated() const final;
+
+    void rewind() final;
+    const TraceRecord& next() final;
+  };
+
+  // Opens the trace file with the reader matching to its format.
+  TraceReader build_trace_reader(const std::string& path);
+
+  // Converts an ASCII trace into the binary format, and returns the number
+  // of converted records.
+  uint64_t convert_trace_to_binary(const std::string& ascii_path,
+                                   const std::string& binary_path);
+}
+
+#endif /* Predefined include guard __MQSim__TraceReader__ */
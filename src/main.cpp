@@ -1,26 +1,40 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "exec/params/ExecParameterSet.h"
 #include "exec/HostSystem.h"
 #include "exec/SsdDevice.h"
+#include "host/ioflow/TraceReader.h"
 #include "utils/rapidxml/rapidxml.hpp"
+#include "utils/Console.h"
 #include "utils/Logical_Address_Partitioning_Unit.h"
 
 using namespace std;
 
 #define FILE_PATH_OPT     "-i"
 #define WORKLOAD_PATH_OPT "-w"
+#define JOBS_OPT          "-j"
+#define CONVERT_TRACE_OPT "-c"
 
-force_inline void
-command_line_args(char* argv[],
+force_inline bool
+command_line_args(int argc,
+                  char* argv[],
                   string& input_file_path,
-                  string& workload_file_path)
+                  string& workload_file_path,
+                  uint32_t& jobs)
 {
-  for (int arg_cntr = 1; arg_cntr < 5; arg_cntr++) {
+  for (int arg_cntr = 1; arg_cntr < argc - 1; arg_cntr++) {
     string arg = argv[arg_cntr];
 
     if (arg.compare(0, strlen(FILE_PATH_OPT), FILE_PATH_OPT) == 0) {
@@ -32,7 +46,24 @@ command_line_args(char* argv[],
       workload_file_path.assign(argv[++arg_cntr]);
       continue;
     }
+
+    if (arg.compare(0, strlen(JOBS_OPT), JOBS_OPT) == 0) {
+      const char* value = argv[++arg_cntr];
+      char* end = nullptr;
+
+      errno = 0;
+      unsigned long parsed = std::strtoul(value, &end, 10);
+
+      if (end == value || *end != '\0' || errno == ERANGE
+          || value[0] == '-' || parsed == 0 || UINT32_MAX < parsed)
+        return false;
+
+      jobs = uint32_t(parsed);
+      continue;
+    }
   }
+
+  return true;
 }
 
 force_inline void
@@ -146,9 +177,10 @@ __read_workload_definitions(const string& workload_defs_file_path)
 void
 __collect_results(SsdDevice& ssd,
                   HostSystem& host,
-                  const std::string& output_file_path)
+                  const std::string& output_file_path,
+                  const std::string& latency_file_path)
 {
-  cout << "Writing results to output file ......." << endl;
+  Utils::Console::out() << "Writing results to output file ......." << endl;
 
   Utils::XmlWriter xmlwriter;
   xmlwriter.Open(output_file_path);
@@ -160,12 +192,16 @@ __collect_results(SsdDevice& ssd,
 
   xmlwriter.Write_close_tag();
 
-  cout << endl << "[Flow summary]" << endl;
+  host.Report_latency_in_CSV(latency_file_path);
+
+  Utils::Console::out() << endl << "[Flow summary]" << endl;
   for (auto& flow : host.io_flows()) {
-    cout << " - Flow ID: " << flow->ID() << endl
+    Utils::Console::out() << " - Flow ID: " << flow->ID() << endl
          << "   - total generated requests: " << flow->generated_requests() << endl
          << "   - total serviced requests:  " << flow->serviced_requests() << endl;
-    cout << "   - device response time:     " << flow->average_response_time() << " (us)" << endl
+    Utils::Console::out() << "   - device response time:     " << flow->average_response_time() << " (us)" << endl
+         << "   - p99 / p99.9 response time: " << flow->stats().response_time_percentile(99.0)
+         << " / " << flow->stats().response_time_percentile(99.9) << " (us)" << endl
          << "   - end-to-end request delay: " << flow->average_end_to_end_delay() << " (us)" << endl
          << endl;
   }
@@ -180,23 +216,50 @@ void print_help()
        << "Standalone Usage:" << endl
        << "./MQSim "
           "[-i path/to/config/file] "
-          "[-w path/to/workload/file]" << endl;
+          "[-w path/to/workload/file] "
+          "[-j number/of/parallel/scenarios]" << endl
+       << endl
+       << "Trace Conversion:" << endl
+       << "./MQSim "
+          "-c path/to/ascii/trace path/to/binary/trace" << endl;
+}
+
+int
+__convert_trace(const string& ascii_path, const string& binary_path)
+{
+  cout << "Converting input trace file: " << ascii_path << endl;
+
+  try {
+    auto records = Host_Components::convert_trace_to_binary(ascii_path,
+                                                            binary_path);
+
+    cout << records << " requests are written to " << binary_path << endl;
+  } catch (const mqsim_error& e) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+
+  return 0;
 }
 
 void
 __run(const ExecParameterSet& params,
       const IOFlowScenario& scenario,
-      const std::string& result_file_path)
+      const std::string& result_file_path,
+      const std::string& latency_file_path,
+      const std::string& telemetry_file_path)
 {
+  const int device_seed = params.SSD_Device_Configuration.Seed;
+
   /// ==========================================================================
   /// Simualtion Block
   time_t start_time = time(nullptr);
   char* dt = ctime(&start_time);
 
-  cout << "MQSim started at " << dt;
+  Utils::Console::out() << "MQSim started at " << dt;
 
   // The simulator should always be reset, before starting the actual simulation
-  Simulator->Reset();
+  Simulator->Reset(params.Event_Queue_Type);
 
   // Create LogicalAddressPartitioningUnit
   StreamIdInfo stream_info(params.SSD_Device_Configuration,
@@ -212,45 +275,133 @@ __run(const ExecParameterSet& params,
                  addr_partitioner,
                  stream_info);
 
+  if (params.SSD_Device_Configuration.Seed
+        != device_seed + DeviceParameterSet::SEEDS_PER_DEVICE)
+    throw mqsim_error("SSD device took an unexpected number of seeds. Update "
+                      "DeviceParameterSet::SEEDS_PER_DEVICE.");
+
   // Create HostSystem based on the specified parameters
   HostSystem host(params.Host_Configuration,
                    scenario,
                    addr_partitioner,
                    ssd);
 
+  ssd.start_telemetry(telemetry_file_path);
+
   Simulator->Start_simulation();
 
   time_t end_time = time(nullptr);
   dt = ctime(&end_time);
 
-  cout << "MQSim finished at " << dt;
+  Utils::Console::out() << "MQSim finished at " << dt;
   /// ==========================================================================
 
   auto duration = uint64_t(difftime(end_time, start_time));
-  cout << "Total simulation time: "
+  Utils::Console::out() << "Total simulation time: "
        << duration / 3600 << ":"
        << (duration % 3600) / 60
        << ":" << ((duration % 3600) % 60) << endl << endl;
 
   /// Report results.
-  __collect_results(ssd, host, result_file_path);
+  __collect_results(ssd, host, result_file_path, latency_file_path);
+}
+
+void
+__run_scenario(const ExecParameterSet& exec_params,
+               const IOFlowScenariosList& io_scenarios,
+               int s_no)
+{
+  // Each scenario has its own copy of the parameters. Device seeds start
+  // from where the serial execution of the previous scenarios would leave.
+  ExecParameterSet params(exec_params);
+  params.SSD_Device_Configuration.Seed
+    += (s_no - 1) * DeviceParameterSet::SEEDS_PER_DEVICE;
+
+  Utils::Console::out() << "******************************" << endl
+       << "Executing scenario " << s_no
+       << " out of " << io_scenarios.size() << " ......." << endl;
+
+  __run(params,
+        io_scenarios[s_no - 1],
+        params.result_file_path(s_no),
+        params.latency_file_path(s_no),
+        params.telemetry_file_path(s_no));
+}
+
+void
+__run_scenarios(const ExecParameterSet& exec_params,
+                const IOFlowScenariosList& io_scenarios,
+                uint32_t jobs)
+{
+  // Serial execution on the main thread.
+  if (jobs == 1) {
+    for (int s_no = 1; s_no <= int(io_scenarios.size()); ++s_no)
+      __run_scenario(exec_params, io_scenarios, s_no);
+
+    return;
+  }
+
+  // Parallel execution. Every worker thread has its own simulation engine
+  // and takes the next scenario until all scenarios are done.
+  std::atomic<int> next_s_no(1);
+  std::exception_ptr error;
+  std::mutex error_lock;
+
+  std::vector<std::thread> workers;
+
+  for (uint32_t i = 0; i < std::min<size_t>(jobs, io_scenarios.size()); ++i) {
+    workers.emplace_back([&]() {
+      for (int s_no = next_s_no++;
+           s_no <= int(io_scenarios.size());
+           s_no = next_s_no++) {
+        Utils::Console::begin_buffering();
+
+        try {
+          __run_scenario(exec_params, io_scenarios, s_no);
+          Utils::Console::flush();
+
+        } catch (...) {
+          Utils::Console::flush();
+
+          std::lock_guard<std::mutex> guard(error_lock);
+
+          if (!error)
+            error = std::current_exception();
+        }
+      }
+    });
+  }
+
+  for (auto& worker : workers)
+    worker.join();
+
+  if (error)
+    std::rethrow_exception(error);
 }
 
 int
 main(int argc, char* argv[])
 {
   string ssd_config_path, workload_defs_path;
+  uint32_t jobs = 1;
+
+  if (argc == 4 && strcmp(argv[1], CONVERT_TRACE_OPT) == 0)
+    return __convert_trace(argv[2], argv[3]);
 
-  if (argc != 5) {
+  if (argc != 5 && argc != 7) {
     // MQSim expects 2 arguments:
     //  1) the path to the SSD configuration definition file, and
     //  2) the path to the workload definition file
+    // and an optional number of scenarios running in parallel.
     print_help();
     return 1;
   }
 
   // 1. Argument parsing
-  command_line_args(argv, ssd_config_path, workload_defs_path);
+  if (!command_line_args(argc, argv, ssd_config_path, workload_defs_path, jobs)) {
+    print_help();
+    return 1;
+  }
 
   // 2. Load workload definitions
   auto io_scenarios = __read_workload_definitions(workload_defs_path);
@@ -259,19 +410,17 @@ main(int argc, char* argv[])
   ExecParameterSet exec_params(ssd_config_path, workload_defs_path);
 
   // 4. Run simulation
-  int s_no = 0;
-  for (auto& scenario : io_scenarios) {
-    ++s_no;
-
-    cout << "******************************" << endl
-         << "Executing scenario " << s_no
-         << " out of " << io_scenarios.size() << " ......." << endl;
-
-    __run(exec_params,
-          scenario,
-          exec_params.result_file_path(s_no));
+  //
+  // Response time logs are named by the flow ID only, so scenarios running
+  // at the same time would write to the same log files.
+  if (1 < jobs && exec_params.Host_Configuration.Enable_ResponseTime_Logging) {
+    cout << "Response time logging is enabled. "
+            "Scenarios will be executed serially." << endl;
+    jobs = 1;
   }
 
+  __run_scenarios(exec_params, io_scenarios, jobs);
+
   cout << "Simulation complete" << endl;
 
   return 0;
@@ -80,6 +80,44 @@ LPA_type Flash_Chip::Get_metadata(flash_die_ID_type die_id, flash_plane_ID_type
   return page.Metadata.LPA;
 }
 
+void Flash_Chip::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  std::vector<LPA_type> lpas;
+
+  for (auto& die : Dies)
+    for (auto& plane : die.Planes)
+    {
+      writer.write(plane.Healthy_block_no);
+
+      lpas.clear();
+      for (auto& block : plane.Blocks)
+        for (auto& page : block.Pages)
+          lpas.push_back(page.Metadata.LPA);
+
+      writer.write_vector(lpas);
+    }
+}
+
+void Flash_Chip::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  std::vector<LPA_type> lpas;
+
+  for (auto& die : Dies)
+    for (auto& plane : die.Planes)
+    {
+      plane.Healthy_block_no = reader.read<uint32_t>();
+
+      reader.read_vector(lpas);
+      if (lpas.size() != plane.Blocks.size() * page_no_per_block)
+        throw mqsim_error("Checkpoint does not match the flash chip geometry of " + ID());
+
+      auto lpa = lpas.begin();
+      for (auto& block : plane.Blocks)
+        for (auto& page : block.Pages)
+          page.Metadata.LPA = *(lpa++);
+    }
+}
+
 void Flash_Chip::start_command_execution(FlashCommand* command)
 {
   Die& targetDie = Dies[command->Address[0].DieID];
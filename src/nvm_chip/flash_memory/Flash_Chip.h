@@ -6,6 +6,7 @@
 #include "../../sim/SimEvent.h"
 #include "../../sim/Engine.h"
 #include "../../sim/Sim_Reporter.h"
+#include "../../utils/Checkpoint.h"
 #include "../NVM_Chip.h"
 #include "FlashTypes.h"
 #include "Die.h"
@@ -192,6 +193,10 @@ namespace NVM
       LPA_type Get_metadata(flash_die_ID_type die_id, flash_plane_ID_type plane_id, flash_block_ID_type block_id, flash_page_ID_type page_id);//A simplification to decrease the complexity of GC execution! The GC unit may need to know the metadata of a page to decide if a page is valid or invalid.
 
       void connect_to_chip_ready_signal(ChipReadySignalHandlerBase& handler);
+
+      // Stores and restores the page metadata of the chip
+      void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+      void Load_checkpoint(Utils::CheckpointReader& reader);
     };
 
     typedef std::vector<Flash_Chip> FlashChipList;
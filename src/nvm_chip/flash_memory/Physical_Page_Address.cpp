@@ -1,9 +0,0 @@
-#include "Physical_Page_Address.h"
-
-namespace NVM
-{
-  namespace FlashMemory
-  {
-    bool Physical_Page_Address::block_address_constraint_for_multiplane = true;
-  }
-}
\ No newline at end of file
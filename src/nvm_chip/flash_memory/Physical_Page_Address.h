@@ -4,16 +4,12 @@
 #include "../NVM_Memory_Address.h"
 #include "FlashTypes.h"
 
-// TODO Remove static features??
-
 namespace NVM
 {
   namespace FlashMemory
   {
     class Physical_Page_Address : public NVM_Memory_Address
     {
-    private:
-      static bool block_address_constraint_for_multiplane;//Block address of the commands to neighbor planes must be identical for multiplane command execution
     public:
       flash_channel_ID_type ChannelID;
       flash_chip_ID_type ChipID;        //The flashchip ID inside its channel
@@ -44,11 +40,6 @@ namespace NVM
           BlockID(addressToCopy.BlockID),
           PageID(addressToCopy.PageID)
       { }
-
-      static void SetBlockAddressConstraint(const bool BAConstraint)
-      {
-        block_address_constraint_for_multiplane = BAConstraint;
-      }
     };
 
     force_inline std::ostream&
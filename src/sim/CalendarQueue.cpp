@@ -0,0 +1,210 @@
+#include "CalendarQueue.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace MQSimEngine;
+
+// Bucket array never shrinks under this size.
+constexpr uint64_t MIN_BUCKET_COUNT = 16;
+
+// Initial bucket width is 1024 ns, which is close to the interval between
+// the flash and channel events of the default configurations.
+constexpr uint32_t INITIAL_WIDTH_SHIFT = 10;
+
+// Upper bound of the bucket width (about 18 minutes of simulation time).
+constexpr uint32_t MAX_WIDTH_SHIFT = 40;
+
+// Number of the earliest slots used for the bucket width estimation.
+constexpr uint64_t WIDTH_SAMPLE_COUNT = 64;
+
+CalendarQueue::CalendarQueue()
+  : __buckets(MIN_BUCKET_COUNT),
+    __width_shift(INITIAL_WIDTH_SHIFT),
+    __bucket_mask(MIN_BUCKET_COUNT - 1),
+    __count(0),
+    __grow_limit(MIN_BUCKET_COUNT * 2),
+    __shrink_limit(0),
+    __cur_vbucket(0),
+    __min_bucket(nullptr)
+{ }
+
+force_inline void
+CalendarQueue::__insert_slot(const TimeSlot& slot)
+{
+  Bucket& bucket = __bucket_of(slot.key);
+
+  // Slots are sorted in the descending order. New slots are usually near
+  // the current time, so search the insert position from the back.
+  auto i = bucket.size();
+  while (0 < i && bucket[i - 1].key < slot.key)
+    --i;
+
+  bucket.insert(bucket.begin() + i, slot);
+}
+
+CalendarQueue::Bucket*
+CalendarQueue::__find_min_bucket()
+{
+  // 1. Visit buckets in the order of time within a year from the current
+  //    virtual bucket.
+  for (uint64_t vbucket = __cur_vbucket;
+       vbucket < __cur_vbucket + __buckets.size();
+       ++vbucket) {
+    Bucket& bucket = __buckets[vbucket & __bucket_mask];
+
+    if (!bucket.empty() && __vbucket_of(bucket.back().key) == vbucket) {
+      __cur_vbucket = vbucket;
+      return &bucket;
+    }
+  }
+
+  // 2. All slots are far from the current time. Find the minimum directly.
+  Bucket* min_bucket = nullptr;
+
+  for (auto& bucket : __buckets) {
+    if (bucket.empty())
+      continue;
+
+    if (min_bucket == nullptr || bucket.back().key < min_bucket->back().key)
+      min_bucket = &bucket;
+  }
+
+  assert(min_bucket != nullptr);
+
+  __cur_vbucket = __vbucket_of(min_bucket->back().key);
+
+  return min_bucket;
+}
+
+uint32_t
+CalendarQueue::__estimate_width_shift() const
+{
+  if (__count < 2)
+    return __width_shift;
+
+  std::vector<sim_time_type> keys;
+  keys.reserve(__count);
+
+  for (auto& bucket : __buckets)
+    for (auto& slot : bucket)
+      keys.push_back(slot.key);
+
+  auto samples = std::min(keys.size(), size_t(WIDTH_SAMPLE_COUNT));
+  std::partial_sort(keys.begin(), keys.begin() + samples, keys.end());
+
+  // Average separation of the earliest slots, ignoring the separations
+  // larger than twice of the first average as described in the paper.
+  double average = double(keys[samples - 1] - keys[0]) / double(samples - 1);
+
+  double sum = 0;
+  uint64_t count = 0;
+
+  for (size_t i = 1; i < samples; ++i) {
+    auto separation = double(keys[i] - keys[i - 1]);
+
+    if (separation <= 2.0 * average) {
+      sum += separation;
+      ++count;
+    }
+  }
+
+  if (0 < count && 0 < sum)
+    average = sum / double(count);
+
+  // Bucket width should be about three times of the average separation.
+  auto width = uint64_t(3.0 * average);
+
+  uint32_t shift = 0;
+  while (shift < MAX_WIDTH_SHIFT && (1ULL << shift) < width)
+    ++shift;
+
+  return shift;
+}
+
+void
+CalendarQueue::__resize(uint64_t bucket_count)
+{
+  sim_time_type base_time = __cur_vbucket << __width_shift;
+
+  __width_shift = __estimate_width_shift();
+
+  std::vector<Bucket> old_buckets(bucket_count);
+  __buckets.swap(old_buckets);
+
+  __bucket_mask = bucket_count - 1;
+  __grow_limit = bucket_count * 2;
+  __shrink_limit = bucket_count <= MIN_BUCKET_COUNT ? 0 : bucket_count / 2;
+  __cur_vbucket = base_time >> __width_shift;
+
+  for (auto& bucket : old_buckets)
+    for (auto& slot : bucket)
+      __insert_slot(slot);
+
+  // The slot in progress is still the minimum of the rebuilt calendar.
+  if (__min_bucket != nullptr)
+    __min_bucket = __find_min_bucket();
+}
+
+void
+CalendarQueue::Insert_sim_event(SimEvent* event)
+{
+  sim_time_type key = event->Fire_time;
+  Bucket& bucket = __bucket_of(key);
+
+  // 1. Append to the existing slot if the fire time is already registered.
+  auto i = bucket.size();
+  while (0 < i && bucket[i - 1].key < key)
+    --i;
+
+  if (0 < i && bucket[i - 1].key == key) {
+    bucket[i - 1].last->Next_event = event;
+    bucket[i - 1].last = event;
+    return;
+  }
+
+  // 2. Create a new time slot.
+  bucket.insert(bucket.begin() + i, TimeSlot{key, event, event});
+
+  if (__vbucket_of(key) < __cur_vbucket)
+    __cur_vbucket = __vbucket_of(key);
+
+  if (++__count > __grow_limit)
+    __resize(__buckets.size() * 2);
+}
+
+SimEvent*
+CalendarQueue::Get_min_events()
+{
+  assert(is_exist());
+
+  __min_bucket = __find_min_bucket();
+
+  return __min_bucket->back().first;
+}
+
+void
+CalendarQueue::Remove_min_events()
+{
+  assert(__min_bucket != nullptr);
+
+  __min_bucket->pop_back();
+  __min_bucket = nullptr;
+
+  if (--__count < __shrink_limit)
+    __resize(__buckets.size() / 2);
+}
+
+void
+CalendarQueue::Clear()
+{
+  std::vector<Bucket>(MIN_BUCKET_COUNT).swap(__buckets);
+
+  __width_shift = INITIAL_WIDTH_SHIFT;
+  __bucket_mask = MIN_BUCKET_COUNT - 1;
+  __count = 0;
+  __grow_limit = MIN_BUCKET_COUNT * 2;
+  __shrink_limit = 0;
+  __cur_vbucket = 0;
+  __min_bucket = nullptr;
+}
@@ -0,0 +1,97 @@
+//
+// CalendarQueue
+// MQSim
+//
+
+#ifndef __MQSim__CalendarQueue__
+#define __MQSim__CalendarQueue__
+
+#include <vector>
+
+#include "EventQueue.h"
+
+namespace MQSimEngine {
+  // ------------------------------------------------------------------------
+  // Calendar queue event scheduler
+  //
+  // Time slots are hashed into an array of buckets which covers a "year" of
+  // (bucket count * bucket width) nanoseconds. Each bucket stores its slots
+  // inline in a vector sorted by descending fire time, so the earliest slot
+  // of a bucket is always the last element and can be popped without moving
+  // the others. The bucket count follows the number of pending slots, and
+  // the bucket width is re-estimated from the slot separation on resizing.
+  // Both insert and pop-min are O(1) amortized.
+  // ------------------------------------------------------------------------
+  class CalendarQueue : public EventQueue {
+  private:
+    struct TimeSlot {
+      sim_time_type key;
+      SimEvent* first;
+      SimEvent* last;
+    };
+
+    typedef std::vector<TimeSlot> Bucket;
+
+  private:
+    std::vector<Bucket> __buckets;
+
+    // Bucket width is always 2^__width_shift to replace division with shift.
+    uint32_t __width_shift;
+    uint64_t __bucket_mask;
+
+    // Number of pending time slots (not the number of events).
+    uint64_t __count;
+
+    // Resizing thresholds of the bucket array.
+    uint64_t __grow_limit;
+    uint64_t __shrink_limit;
+
+    // Virtual bucket number (fire time >> __width_shift) of the last found
+    // minimum. There is no time slot before this virtual bucket.
+    uint64_t __cur_vbucket;
+
+    // Bucket holding the slot returned by the last Get_min_events().
+    Bucket* __min_bucket;
+
+  private:
+    uint64_t __vbucket_of(sim_time_type key) const;
+    Bucket& __bucket_of(sim_time_type key);
+
+    Bucket* __find_min_bucket();
+
+    void __insert_slot(const TimeSlot& slot);
+    void __resize(uint64_t bucket_count);
+    uint32_t __estimate_width_shift() const;
+
+  public:
+    CalendarQueue();
+    ~CalendarQueue() override = default;
+
+    bool is_exist() const final;
+
+    void Insert_sim_event(SimEvent* event) final;
+    SimEvent* Get_min_events() final;
+    void Remove_min_events() final;
+    void Clear() final;
+  };
+
+  force_inline uint64_t
+  CalendarQueue::__vbucket_of(sim_time_type key) const
+  {
+    return key >> __width_shift;
+  }
+
+  force_inline CalendarQueue::Bucket&
+  CalendarQueue::__bucket_of(sim_time_type key)
+  {
+    return __buckets[__vbucket_of(key) & __bucket_mask];
+  }
+
+  force_inline bool
+  CalendarQueue::is_exist() const
+  {
+    return __count > 0;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__CalendarQueue__ */
@@ -4,18 +4,22 @@
 
 using namespace MQSimEngine;
 
-Engine* Engine::_instance = nullptr;
+thread_local std::unique_ptr<Engine> Engine::_instance;
 
 
-void Engine::Reset()
+void Engine::Reset(Event_Queue_Type queue_type)
 {
   __pool.destroy_all();
 
-  _EventList->Clear();
+  _EventList = build_event_queue_object(queue_type);
   _ObjectList.clear();
   _sim_time = 0;
   stop = false;
   started = false;
+
+  __sampler = nullptr;
+  __sampling_period = 0;
+  __next_sampling_time = MAXIMUM_TIME;
 }
 
 //Add an object to the simulator object list
@@ -62,8 +66,10 @@ void Engine::Start_simulation()
     obj.second->Start_simulation();
 
   while (!stop && _EventList->is_exist()) {
-    EventTreeNode* minNode = _EventList->Get_min_node();
-    auto* ev = minNode->FirstSimEvent;
+    auto* ev = _EventList->Get_min_events();
+
+    if (__sampler)
+      __sample_until(ev->Fire_time);
 
     _sim_time = ev->Fire_time;
 
@@ -77,7 +83,7 @@ void Engine::Start_simulation()
       consumed_event->release();
     }
 
-    _EventList->Remove(minNode);
+    _EventList->Remove_min_events();
   }
 }
 
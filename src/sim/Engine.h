@@ -2,31 +2,44 @@
 #define ENGINE_H
 
 #include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <unordered_map>
 #include "Sim_Defs.h"
 #include "SimEvent.h"
-#include "EventTree.h"
+#include "EventQueue.h"
 #include "Sim_Object.h"
+#include "../utils/Exception.h"
 
 #define Simulator MQSimEngine::Engine::Instance()
 
 namespace MQSimEngine {
   class Engine
   {
-    friend class EventTree;
+  public:
+    typedef std::function<void(sim_time_type)> Sampler;
 
   private:
-    static Engine* _instance;
+    // Each thread owns its engine so that the scenarios can be simulated
+    // concurrently on the different threads. The engine is released when
+    // its thread exits.
+    static thread_local std::unique_ptr<Engine> _instance;
 
     sim_time_type _sim_time;
-    EventTree* _EventList;
+    EventQueuePtr _EventList;
     std::unordered_map<sim_object_id_type, Sim_Object*> _ObjectList;
     bool stop;
     bool started;
 
     SimEventPool __pool;
 
+    Sampler       __sampler;
+    sim_time_type __sampling_period;
+    sim_time_type __next_sampling_time;
+
+    void __sample_until(sim_time_type time);
+
   public:
     Engine();
     ~Engine();
@@ -40,7 +53,12 @@ namespace MQSimEngine {
                                  void* parameters = nullptr,
                                  int type = 0);
     void Ignore_sim_event(SimEvent*);
-    void Reset();
+
+    // Calls the sampler at every multiple of the period, before the events
+    // of that time are executed. The sampler does not own any event, so it
+    // changes neither the event order nor the simulation end time.
+    void Register_sampler(const Sampler& sampler, sim_time_type period);
+    void Reset(Event_Queue_Type queue_type = Event_Queue_Type::CALENDAR);
     void AddObject(Sim_Object* obj);
     Sim_Object* GetObject(const sim_object_id_type& object_id);
     void RemoveObject(Sim_Object* obj);
@@ -54,24 +72,25 @@ namespace MQSimEngine {
   force_inline
   Engine::Engine()
     : _sim_time(0),
-      _EventList(new EventTree()),
+      _EventList(build_event_queue_object(Event_Queue_Type::CALENDAR)),
       _ObjectList(),
       stop(false),
-      started(false)
+      started(false),
+      __pool(),
+      __sampler(),
+      __sampling_period(0),
+      __next_sampling_time(MAXIMUM_TIME)
   { }
 
   force_inline
-  Engine::~Engine()
-  {
-    delete _EventList;
-  }
+  Engine::~Engine() = default;
 
   force_inline Engine*
   Engine::Instance() {
-    if (_instance == nullptr)
-      _instance = new Engine();
+    if (!_instance)
+      _instance.reset(new Engine());
 
-    return _instance;
+    return _instance.get();
   }
 
   force_inline SimEvent*
@@ -80,6 +99,9 @@ namespace MQSimEngine {
                              void* parameters,
                              int type)
   {
+    if (fireTime < _sim_time)
+      throw mqsim_error("Illegal request to register a simulation event before Now!");
+
     auto* ev = __pool.construct(fireTime, targetObject, parameters, type);
 
     PRINT_DEBUG("RegisterEvent " << fireTime << " " << targetObject)
@@ -89,6 +111,28 @@ namespace MQSimEngine {
     return ev;
   }
 
+  force_inline void
+  Engine::__sample_until(sim_time_type time)
+  {
+    while (__next_sampling_time <= time) {
+      _sim_time = __next_sampling_time;
+      __sampler(_sim_time);
+
+      __next_sampling_time += __sampling_period;
+    }
+  }
+
+  force_inline void
+  Engine::Register_sampler(const Sampler& sampler, sim_time_type period)
+  {
+    if (period == 0)
+      throw mqsim_error("The sampling period should be larger than 0");
+
+    __sampler = sampler;
+    __sampling_period = period;
+    __next_sampling_time = _sim_time + period;
+  }
+
   force_inline sim_time_type
   Engine::Time() const
   {
@@ -0,0 +1,22 @@
+#include "EventQueue.h"
+
+// Children classes
+#include "CalendarQueue.h"
+#include "EventTree.h"
+
+using namespace MQSimEngine;
+
+// -------------------
+// Event queue builder
+// -------------------
+EventQueuePtr
+MQSimEngine::build_event_queue_object(Event_Queue_Type type)
+{
+  switch (type) {
+  case Event_Queue_Type::RB_TREE:
+    return std::make_shared<EventTree>();
+
+  case Event_Queue_Type::CALENDAR:
+    return std::make_shared<CalendarQueue>();
+  }
+}
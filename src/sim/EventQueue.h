@@ -0,0 +1,94 @@
+//
+// EventQueue
+// MQSim
+//
+
+#ifndef __MQSim__EventQueue__
+#define __MQSim__EventQueue__
+
+#include <memory>
+#include <string>
+
+#include "Sim_Defs.h"
+#include "SimEvent.h"
+
+#include "../utils/EnumTools.h"
+#include "../utils/Exception.h"
+#include "../utils/InlineTools.h"
+#include "../utils/StringTools.h"
+
+// ======================================
+// Enumerators and its string converters.
+// ======================================
+namespace MQSimEngine {
+  enum class Event_Queue_Type {
+    // Red-black tree keyed by the event fire time (original MQSim engine).
+    RB_TREE,
+
+    // Calendar queue described in: "R. Brown, Calendar Queues: A Fast O(1)
+    // Priority Queue Implementation for the Simulation Event Set Problem,
+    // Communications of the ACM, 1988".
+    CALENDAR
+  };
+}
+
+force_inline std::string
+to_string(MQSimEngine::Event_Queue_Type type)
+{
+  using namespace MQSimEngine;
+
+  switch (type) {
+  case ENUM_TO_STR(Event_Queue_Type, RB_TREE);
+  case ENUM_TO_STR(Event_Queue_Type, CALENDAR);
+  }
+}
+
+force_inline MQSimEngine::Event_Queue_Type
+to_event_queue_type(std::string v)
+{
+  using namespace MQSimEngine;
+
+  Utils::to_upper(v);
+
+  STR_TO_ENUM(Event_Queue_Type, RB_TREE);
+  STR_TO_ENUM(Event_Queue_Type, CALENDAR);
+
+  throw mqsim_error("Unknown event queue type specified in the SSD "
+                    "configuration file");
+}
+
+namespace MQSimEngine {
+  // ------------------------------------------------------------------------
+  // EventQueue is the pending event set of the simulation engine. Events are
+  // grouped into time slots by their fire time, and the events inside a slot
+  // are kept in the registration order.
+  //
+  // The earliest slot stays in the queue while the engine is executing it,
+  // so the events registered for the current time are appended to the chain
+  // which is in progress. All implementations should follow this behavior to
+  // give the same simulation result.
+  // ------------------------------------------------------------------------
+  class EventQueue {
+  public:
+    EventQueue() = default;
+    virtual ~EventQueue() = default;
+
+    virtual bool is_exist() const = 0;
+
+    virtual void Insert_sim_event(SimEvent* event) = 0;
+
+    // Returns the first event of the earliest time slot.
+    virtual SimEvent* Get_min_events() = 0;
+
+    // Removes the time slot returned by the last Get_min_events().
+    virtual void Remove_min_events() = 0;
+
+    virtual void Clear() = 0;
+  };
+
+  typedef std::shared_ptr<EventQueue> EventQueuePtr;
+
+  EventQueuePtr build_event_queue_object(Event_Queue_Type type);
+}
+
+#endif /* Predefined include guard __MQSim__EventQueue__ */
@@ -1,14 +1,11 @@
 #include "EventTree.h"
-#include "Engine.h"
-#include "../utils/Exception.h"
 
 using namespace MQSimEngine;
 
-EventTreeNode* EventTree::__sentinel = nullptr;
-
 EventTree::EventTree()
   : __pool(),
-    __count(0)
+    __count(0),
+    __min_node(nullptr)
 {
   // set up the sentinel node. the sentinel node is the key to a successfull
   // implementation and for understanding the red-black tree properties.
@@ -21,11 +18,7 @@ EventTree::EventTree()
   __last_found_node = __sentinel;
 }
 
-EventTree::~EventTree()
-{
-  if (__sentinel)
-    __sentinel->release();
-}
+EventTree::~EventTree() = default;
 
 ///<summary>
 /// RestoreAfterInsert
@@ -400,9 +393,6 @@ EventTree::GetData(sim_time_type key)
 void
 EventTree::Insert_sim_event(SimEvent* event)
 {
-  if (event->Fire_time < Engine::Instance()->Time())
-    throw mqsim_error("Illegal request to register a simulation event before Now!");
-
   sim_time_type key = event->Fire_time;
   EventTreeNode* treeNode = __rb_tree;     // begin at root
 
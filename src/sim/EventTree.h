@@ -1,14 +1,13 @@
 #ifndef EVENT_TREE_H
 #define EVENT_TREE_H
 
+#include "EventQueue.h"
 #include "Sim_Defs.h"
 #include "SimEvent.h"
 
 #include "../utils/InlineTools.h"
 #include "../utils/ObjectPool.h"
 
-// TODO Remove static features if possible
-
 namespace MQSimEngine
 {
   class EventTreeNodeBase;
@@ -47,7 +46,7 @@ namespace MQSimEngine
       Parent(nullptr)
   { }
 
-  class EventTree {
+  class EventTree : public EventQueue {
   private:
     // Object Pool for EventTreeNode
     EventTreeNodePool __pool;
@@ -56,12 +55,14 @@ namespace MQSimEngine
     int __count;
 
     //  sentinelNode is convenient way of indicating a leaf node.
-    static EventTreeNode* __sentinel;
+    EventTreeNode* __sentinel;
 
     // the tree
     EventTreeNode* __rb_tree;
     // the node that was last found; used to optimize searches
     EventTreeNode* __last_found_node;
+    // the node returned by Get_min_events and being executed by the engine
+    EventTreeNode* __min_node;
 
   private:
     void RestoreAfterInsert(EventTreeNode* x);
@@ -70,22 +71,25 @@ namespace MQSimEngine
 
   public:
     EventTree();
-    ~EventTree();
+    ~EventTree() override;
 
-    bool is_exist() const;
+    bool is_exist() const final;
 
     void Add(sim_time_type key, SimEvent* data);
     void RotateLeft(EventTreeNode* x);
     void RotateRight(EventTreeNode* x);
     SimEvent* GetData(sim_time_type key);
-    void Insert_sim_event(SimEvent* data);
+    void Insert_sim_event(SimEvent* data) final;
     sim_time_type Get_min_key();
     SimEvent* Get_min_value();
     EventTreeNode* Get_min_node();
     void Remove(sim_time_type key);
     void Remove(EventTreeNode* node);
     void Remove_min();
-    void Clear();
+    void Clear() final;
+
+    SimEvent* Get_min_events() final;
+    void Remove_min_events() final;
   };
 
   ///<summary>
@@ -106,6 +110,7 @@ namespace MQSimEngine
   EventTree::Clear()
   {
     __rb_tree = __sentinel;
+    __min_node = nullptr;
     __count = 0;
   }
 
@@ -139,6 +144,30 @@ namespace MQSimEngine
   {
     return Get_min_node()->Key;
   }
+
+  ///<summary>
+  /// Get_min_events
+  /// Returns the event chain of the minimum node. The node remains in the
+  /// tree until Remove_min_events is called.
+  ///<summary>
+  force_inline SimEvent*
+  EventTree::Get_min_events()
+  {
+    __min_node = Get_min_node();
+
+    return __min_node->FirstSimEvent;
+  }
+
+  ///<summary>
+  /// Remove_min_events
+  /// Removes the node returned by the last Get_min_events
+  ///<summary>
+  force_inline void
+  EventTree::Remove_min_events()
+  {
+    Remove(__min_node);
+    __min_node = nullptr;
+  }
 }
 
 #endif // !EVENT_TREE_H
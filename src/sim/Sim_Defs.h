@@ -5,6 +5,8 @@
 #include <string>
 #include <iostream>
 
+#include "../utils/Console.h"
+
 typedef uint64_t sim_time_type;
 typedef uint16_t stream_id_type;
 typedef sim_time_type data_timestamp_type;
@@ -23,7 +25,7 @@ typedef std::string sim_object_id_type;
               std::cin.get();\
               exit(1);\
              }
-#define PRINT_MESSAGE(M) std::cout << M << std::endl;
+#define PRINT_MESSAGE(M) Utils::Console::out() << M << std::endl;
 
 #ifdef DEBUG
 #define PRINT_DEBUG(M) //std::cout<<M<<std::endl;
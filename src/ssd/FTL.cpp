@@ -570,8 +570,19 @@ FTL::__make_uniform_probability(const Utils::Workload_Statistics& stats,
                               steady_state_probability);
     break;
 
+  case GC_Block_Selection_Policy_Type::WINDOWED_GREEDY:
+    // The windowed greedy behaves close to the d-choices with the window
+    // size, as both select the most invalidated block of a d-block subset.
+    __make_rga_gc_probability(stats,
+                              rho,
+                              __gc_and_wl->Get_GC_policy_specific_parameter(),
+                              steady_state_probability);
+    break;
+
   case GC_Block_Selection_Policy_Type::GREEDY:
   case GC_Block_Selection_Policy_Type::FIFO:
+  case GC_Block_Selection_Policy_Type::COST_BENEFIT:
+  case GC_Block_Selection_Policy_Type::COST_AGE_TIMES:
     // As specified in the SIGMETRICS 2013 paper, a larger value for d-choices
     // (the name of RGA in Van Houdt's paper) will lead to results close to
     // greedy. We use d=30 to estimate steady-state of the greedy policy with that
@@ -922,6 +933,20 @@ FTL::Perform_precondition(Utils::WorkloadStatsList&  workload_stats)
     total_accessed_cmt_entries += __unit_precondition(stat, workload_stats.size(), overall_rate);
 }
 
+void
+FTL::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  __address_mapper->Save_checkpoint(writer);
+  __block_manager->Save_checkpoint(writer);
+}
+
+void
+FTL::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  __address_mapper->Load_checkpoint(reader);
+  __block_manager->Load_checkpoint(reader);
+}
+
 void
 FTL::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
 {
@@ -1023,6 +1048,24 @@ FTL::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
   xmlwriter.Write_attribute_string_inline("Average_Page_Movement_For_WL",
                                           __stats.avg_page_movement_for_wl());
 
+  xmlwriter.Write_attribute_string_inline("GC_Block_Selection_Policy",
+                                          to_string(__gc_and_wl->Get_gc_policy()));
+
+  xmlwriter.Write_attribute_string_inline("Write_Amplification_Factor",
+                                          __stats.write_amplification());
+
+  xmlwriter.Write_attribute_string_inline("Average_GC_Latency",
+                                          __stats.avg_gc_latency());
+
+  xmlwriter.Write_attribute_string_inline("GC_Latency_P99",
+                                          __stats.gc_latency_percentile(99.0));
+
+  xmlwriter.Write_attribute_string_inline("GC_Latency_P99_9",
+                                          __stats.gc_latency_percentile(99.9));
+
+  xmlwriter.Write_attribute_string_inline("Max_GC_Latency",
+                                          __stats.gc_latency_percentile(100.0));
+
   xmlwriter.Write_end_element_tag();
 
   // Report TSU information before return;
@@ -132,6 +132,8 @@ namespace SSD_Components
     void dispatch_transactions(const std::list<NvmTransaction*>& transactionList) final;
 
     void Perform_precondition(Utils::WorkloadStatsList& workload_stats);
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
     void Validate_simulation_config();
     LPA_type Convert_host_logical_address_to_device_address(LHA_type lha) const;
     page_status_type Find_NVM_subunit_access_bitmap(LHA_type lha) const;
@@ -156,6 +158,13 @@ namespace SSD_Components
     uint32_t minimum_free_pages_before_gc() const;
     bool stop_write_services_for_gc(const NVM::FlashMemory::Physical_Page_Address& plane);
     bool is_in_urgent_gc(const NVM::FlashMemory::Flash_Chip* chip) const;
+
+    // Telemetry passing functions
+    ChipQueueLengths queue_lengths(flash_channel_ID_type channel_id,
+                                   flash_chip_ID_type chip_id) const;
+    ChipBlockPoolState block_pool_state(flash_channel_ID_type channel_id,
+                                        flash_chip_ID_type chip_id) const;
+    uint32_t cmt_occupancy() const;
   };
 
   force_inline void
@@ -197,6 +206,20 @@ namespace SSD_Components
   force_inline bool
   FTL::is_in_urgent_gc(const NVM::FlashMemory::Flash_Chip* chip) const
   { return __gc_and_wl->GC_is_in_urgent_mode(chip); }
+
+  force_inline ChipQueueLengths
+  FTL::queue_lengths(flash_channel_ID_type channel_id,
+                     flash_chip_ID_type chip_id) const
+  { return __tsu->Get_queue_lengths(channel_id, chip_id); }
+
+  force_inline ChipBlockPoolState
+  FTL::block_pool_state(flash_channel_ID_type channel_id,
+                        flash_chip_ID_type chip_id) const
+  { return __block_manager->Get_chip_block_pool_state(channel_id, chip_id); }
+
+  force_inline uint32_t
+  FTL::cmt_occupancy() const
+  { return __address_mapper->Get_current_cmt_occupancy(); }
 }
 
 
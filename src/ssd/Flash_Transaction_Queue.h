@@ -1,36 +1,87 @@
 #ifndef FLASH_TRANSACTION_QUEUE_H
 #define FLASH_TRANSACTION_QUEUE_H
 
-#include <list>
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <vector>
 #include "NvmTransactionFlash.h"
 #include "Queue_Probe.h"
 #include "../sim/Sim_Reporter.h"
 
+#include "../utils/Exception.h"
 #include "../utils/InlineTools.h"
 
 namespace SSD_Components
 {
+  // Intrusive doubly linked queue of the flash transactions. The links and
+  // the enqueue time are kept in the Queue_hook of the transactions, so the
+  // enqueue, the dequeue and the removal at any position take O(1) without
+  // any allocation. As in std::list, the end of the queue is a sentinel
+  // which is followed by the front element.
   class Flash_Transaction_Queue : public MQSimEngine::Sim_Reporter
   {
+  public:
+    template <typename Hook>
+    class Iterator {
+    private:
+      Hook* __hook;
+
+      friend class Flash_Transaction_Queue;
+
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef NvmTransactionFlash*            value_type;
+      typedef std::ptrdiff_t                  difference_type;
+      typedef NvmTransactionFlash* const*     pointer;
+      typedef NvmTransactionFlash* const&     reference;
+
+      explicit Iterator(Hook* hook);
+
+      reference operator*() const;
+
+      Iterator& operator++();
+      Iterator operator++(int);
+      Iterator& operator--();
+      Iterator operator--(int);
+
+      bool operator==(const Iterator& rhs) const;
+      bool operator!=(const Iterator& rhs) const;
+    };
+
+    typedef Iterator<TransactionQueueHook>       iterator;
+    typedef Iterator<const TransactionQueueHook> const_iterator;
+
   private:
     std::string __id;
-    std::list<NvmTransactionFlash*> __queue;
+    TransactionQueueHook __sentinel;
+    size_t __size;
     Queue_Probe __queue_probe;
 
+    void __link(TransactionQueueHook& hook, TransactionQueueHook& position);
+    void __unlink(TransactionQueueHook& hook);
+
   public:
     Flash_Transaction_Queue();
     explicit Flash_Transaction_Queue(std::string id);
 
     ~Flash_Transaction_Queue() final = default;
 
+    // The linked transactions point to the sentinel of the queue
+    Flash_Transaction_Queue(const Flash_Transaction_Queue&) = delete;
+    Flash_Transaction_Queue& operator=(const Flash_Transaction_Queue&) = delete;
+
     void Set_id(const std::string& id);
 
-    void remove(std::list<NvmTransactionFlash*>::iterator const& itr_pos);
+    void remove(iterator const& itr_pos);
 
     void push_back(NvmTransactionFlash* const&);
     void push_front(NvmTransactionFlash* const&);
-    std::list<NvmTransactionFlash*>::iterator insert(std::list<NvmTransactionFlash*>::iterator position, NvmTransactionFlash* const& transaction);
+    iterator insert(iterator const& position, NvmTransactionFlash* const& transaction);
+
+    // Moves a transaction of this queue in front of the position, without
+    // changing its enqueue time and the queue statistics.
+    void splice(iterator const& position, NvmTransactionFlash* const& transaction);
     void remove(NvmTransactionFlash* const& transaction);
     void pop_front();
 
@@ -38,10 +89,10 @@ namespace SSD_Components
     size_t size() const;
     NvmTransactionFlash* front();
 
-    std::list<NvmTransactionFlash*>::iterator begin();
-    std::list<NvmTransactionFlash*>::iterator end();
-    std::list<NvmTransactionFlash*>::const_iterator begin() const;
-    std::list<NvmTransactionFlash*>::const_iterator end() const;
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
     void Report_results_in_XML(std::string name_prefix,
                                Utils::XmlWriter& xmlwriter) final;
@@ -50,23 +101,116 @@ namespace SSD_Components
 
   typedef std::vector<Flash_Transaction_Queue> FlashTransactionQueueList;
 
-  // TODO Need to change normal pointer to shared_ptr
+  template <typename Hook>
+  force_inline
+  Flash_Transaction_Queue::Iterator<Hook>::Iterator(Hook* hook)
+    : __hook(hook)
+  { }
+
+  template <typename Hook>
+  force_inline typename Flash_Transaction_Queue::Iterator<Hook>::reference
+  Flash_Transaction_Queue::Iterator<Hook>::operator*() const
+  {
+    return __hook->Owner;
+  }
+
+  template <typename Hook>
+  force_inline Flash_Transaction_Queue::Iterator<Hook>&
+  Flash_Transaction_Queue::Iterator<Hook>::operator++()
+  {
+    __hook = __hook->Next;
+    return *this;
+  }
+
+  template <typename Hook>
+  force_inline Flash_Transaction_Queue::Iterator<Hook>
+  Flash_Transaction_Queue::Iterator<Hook>::operator++(int)
+  {
+    Iterator prev(*this);
+    __hook = __hook->Next;
+    return prev;
+  }
+
+  template <typename Hook>
+  force_inline Flash_Transaction_Queue::Iterator<Hook>&
+  Flash_Transaction_Queue::Iterator<Hook>::operator--()
+  {
+    __hook = __hook->Prev;
+    return *this;
+  }
+
+  template <typename Hook>
+  force_inline Flash_Transaction_Queue::Iterator<Hook>
+  Flash_Transaction_Queue::Iterator<Hook>::operator--(int)
+  {
+    Iterator next(*this);
+    __hook = __hook->Prev;
+    return next;
+  }
+
+  template <typename Hook>
+  force_inline bool
+  Flash_Transaction_Queue::Iterator<Hook>::operator==(const Iterator& rhs) const
+  {
+    return __hook == rhs.__hook;
+  }
+
+  template <typename Hook>
+  force_inline bool
+  Flash_Transaction_Queue::Iterator<Hook>::operator!=(const Iterator& rhs) const
+  {
+    return __hook != rhs.__hook;
+  }
 
   force_inline
   Flash_Transaction_Queue::Flash_Transaction_Queue()
-    : MQSimEngine::Sim_Reporter(),
-      __id(),
-      __queue(),
-      __queue_probe()
+    : Flash_Transaction_Queue(std::string())
   { }
 
   force_inline
   Flash_Transaction_Queue::Flash_Transaction_Queue(std::string id)
     : MQSimEngine::Sim_Reporter(),
       __id(std::move(id)),
-      __queue(),
+      __sentinel(nullptr),
+      __size(0),
       __queue_probe()
-  { }
+  {
+    __sentinel.Prev = &__sentinel;
+    __sentinel.Next = &__sentinel;
+  }
+
+  force_inline void
+  Flash_Transaction_Queue::__link(TransactionQueueHook& hook,
+                                  TransactionQueueHook& position)
+  {
+#if RUN_EXCEPTION_CHECK
+    if (hook.Is_linked())
+      throw mqsim_error("The transaction is already in a queue!");
+#endif
+
+    hook.Prev = position.Prev;
+    hook.Next = &position;
+    position.Prev->Next = &hook;
+    position.Prev = &hook;
+
+    hook.Enqueue_time = Simulator->Time();
+    ++__size;
+
+    __queue_probe.EnqueueRequest();
+  }
+
+  force_inline void
+  Flash_Transaction_Queue::__unlink(TransactionQueueHook& hook)
+  {
+    __queue_probe.DequeueRequest(hook.Enqueue_time);
+
+    hook.Prev->Next = hook.Next;
+    hook.Next->Prev = hook.Prev;
+    hook.Prev = nullptr;
+    hook.Next = nullptr;
+
+    --__size;
+  }
 
   force_inline void
   Flash_Transaction_Queue::Set_id(const std::string& id)
@@ -75,86 +219,101 @@ namespace SSD_Components
   }
 
   force_inline void
-  Flash_Transaction_Queue::remove(std::list<NvmTransactionFlash*>::iterator const& itr_pos)
+  Flash_Transaction_Queue::remove(iterator const& itr_pos)
   {
-    __queue_probe.DequeueRequest(*itr_pos);
-    __queue.erase(itr_pos);
+    __unlink(*itr_pos.__hook);
   }
 
   force_inline void
   Flash_Transaction_Queue::push_back(NvmTransactionFlash* const& transaction)
   {
-    __queue_probe.EnqueueRequest(transaction);
-    return __queue.push_back(transaction);
+    __link(transaction->Queue_hook, __sentinel);
   }
 
   force_inline void
   Flash_Transaction_Queue::push_front(NvmTransactionFlash* const& transaction)
   {
-    __queue_probe.EnqueueRequest(transaction);
-    return __queue.push_front(transaction);
+    __link(transaction->Queue_hook, *__sentinel.Next);
   }
 
-  force_inline std::list<NvmTransactionFlash*>::iterator
-  Flash_Transaction_Queue::insert(std::list<NvmTransactionFlash*>::iterator position, NvmTransactionFlash* const& transaction)
+  force_inline Flash_Transaction_Queue::iterator
+  Flash_Transaction_Queue::insert(iterator const& position,
+                                  NvmTransactionFlash* const& transaction)
   {
-    __queue_probe.EnqueueRequest(transaction);
-    return __queue.insert(position, transaction);
+    __link(transaction->Queue_hook, *position.__hook);
+    return iterator(&transaction->Queue_hook);
   }
+
+  force_inline void
+  Flash_Transaction_Queue::splice(iterator const& position,
+                                  NvmTransactionFlash* const& transaction)
+  {
+    auto& hook = transaction->Queue_hook;
+
+    if (&hook == position.__hook)
+      return;
+
+    hook.Prev->Next = hook.Next;
+    hook.Next->Prev = hook.Prev;
+
+    hook.Prev = position.__hook->Prev;
+    hook.Next = position.__hook;
+    position.__hook->Prev->Next = &hook;
+    position.__hook->Prev = &hook;
+  }
+
   force_inline void
   Flash_Transaction_Queue::remove(NvmTransactionFlash* const& transaction)
   {
-    __queue_probe.DequeueRequest(transaction);
-    return __queue.remove(transaction);
+    __unlink(transaction->Queue_hook);
   }
 
   force_inline void
   Flash_Transaction_Queue::pop_front()
   {
-    __queue_probe.DequeueRequest(__queue.front());
-    __queue.pop_front();
+    __unlink(*__sentinel.Next);
   }
 
   force_inline size_t
   Flash_Transaction_Queue::size() const
   {
-    return __queue.size();
+    return __size;
   }
 
   force_inline bool
   Flash_Transaction_Queue::empty() const
   {
-    return __queue.empty();
+    return __size == 0;
   }
 
   force_inline NvmTransactionFlash*
   Flash_Transaction_Queue::front()
   {
-    return __queue.front();
+    return __sentinel.Next->Owner;
   }
 
-  force_inline std::list<NvmTransactionFlash*>::const_iterator
+  force_inline Flash_Transaction_Queue::const_iterator
   Flash_Transaction_Queue::begin() const
   {
-    return __queue.begin();
+    return const_iterator(__sentinel.Next);
   }
 
-  force_inline std::list<NvmTransactionFlash*>::iterator
+  force_inline Flash_Transaction_Queue::iterator
   Flash_Transaction_Queue::begin()
   {
-    return __queue.begin();
+    return iterator(__sentinel.Next);
   }
 
-  force_inline std::list<NvmTransactionFlash*>::const_iterator
+  force_inline Flash_Transaction_Queue::const_iterator
   Flash_Transaction_Queue::end() const
   {
-    return __queue.end();
+    return const_iterator(&__sentinel);
   }
 
-  force_inline std::list<NvmTransactionFlash*>::iterator
+  force_inline Flash_Transaction_Queue::iterator
   Flash_Transaction_Queue::end()
   {
-    return __queue.end();
+    return iterator(&__sentinel);
   }
 
   force_inline void
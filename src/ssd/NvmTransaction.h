@@ -31,9 +31,6 @@ namespace SSD_Components
     Transaction_Type Type;
     UserRequest* UserIORequest;
 
-    // Just used for high performance linked-list insertion/deletion
-    // std::list<NvmTransaction*>::iterator RelatedNodeInQueue;
-
     /*
      * Used to calculate service time and transfer time for a normal
      * read/program operation used to respond to the host IORequests. In other
@@ -18,6 +18,41 @@
 
 namespace SSD_Components
 {
+  class NvmTransactionFlash;
+
+  // Intrusive link of Flash_Transaction_Queue. The linked hooks of a queue
+  // form a circular list around the sentinel hook of the queue, which has no
+  // owner, so a transaction is in at most one queue at a time.
+  struct TransactionQueueHook {
+    TransactionQueueHook* Prev;
+    TransactionQueueHook* Next;
+    NvmTransactionFlash* const Owner;
+
+    // Used by the queue probe to calculate the waiting time in the queue
+    sim_time_type Enqueue_time;
+
+    explicit TransactionQueueHook(NvmTransactionFlash* owner);
+
+    TransactionQueueHook(const TransactionQueueHook&) = delete;
+    TransactionQueueHook& operator=(const TransactionQueueHook&) = delete;
+
+    bool Is_linked() const;
+  };
+
+  force_inline
+  TransactionQueueHook::TransactionQueueHook(NvmTransactionFlash* owner)
+    : Prev(nullptr),
+      Next(nullptr),
+      Owner(owner),
+      Enqueue_time(INVALID_TIME)
+  { }
+
+  force_inline bool
+  TransactionQueueHook::Is_linked() const
+  {
+    return Next != nullptr;
+  }
+
   class NvmTransactionFlash : public NvmTransaction {
   public:
     NVM::FlashMemory::Physical_Page_Address Address;
@@ -29,11 +64,11 @@ namespace SSD_Components
     LPA_type LPA;
     PPA_type PPA;
 
-#if UNBLOCK_NOT_IN_USE
     // Used in scheduling methods, such as FLIN, where fairness and QoS is
     // considered in scheduling
     sim_time_type Estimated_alone_waiting_time;
 
+#if UNBLOCK_NOT_IN_USE
     // Especially used in queue reordering inf FLIN scheduler
     bool FLIN_Barrier;
 #endif
@@ -41,6 +76,8 @@ namespace SSD_Components
     bool SuspendRequired;
     bool Physical_address_determined;
 
+    TransactionQueueHook Queue_hook;
+
   protected:
     NvmTransactionFlash(Transaction_Source_Type source,
                         Transaction_Type type,
@@ -75,11 +112,13 @@ namespace SSD_Components
       Data_and_metadata_size_in_byte(data_size_in_byte),
       LPA(lpa),
       PPA(ppa),
+      Estimated_alone_waiting_time(0),
 #if UNBLOCK_NOT_IN_USE
       FLIN_Barrier(false),
 #endif
       SuspendRequired(false),
-      Physical_address_determined(false)
+      Physical_address_determined(false),
+      Queue_hook(this)
   { }
 
   force_inline
@@ -96,11 +135,13 @@ namespace SSD_Components
       Data_and_metadata_size_in_byte(data_size_in_byte),
       LPA(lpa),
       PPA(ppa),
+      Estimated_alone_waiting_time(0),
 #if UNBLOCK_NOT_IN_USE
       FLIN_Barrier(false),
 #endif
       SuspendRequired(false),
-      Physical_address_determined(false)
+      Physical_address_determined(false),
+      Queue_hook(this)
   { }
 }
 
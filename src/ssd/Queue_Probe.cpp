@@ -34,33 +34,19 @@ namespace SSD_Components
     statesEpoch[count].nEnterances++;
   }
 
-  void Queue_Probe::EnqueueRequest(NvmTransaction* transaction)
+  void Queue_Probe::EnqueueRequest()
   {
-#if RUN_EXCEPTION_CHECK
-    if (transaction == nullptr)
-      throw mqsim_error("Inserting a null object to queue!");
-#endif
-
-    currentObjectsInQueue.insert(TransactionTimeMap::value_type(transaction, Simulator->Time()));
-    //currentObjectsInQueue[transaction] = Simulator->Time();
     nRequests++;
     nRequestsEpoch++;
     setCount(count + 1);
   }
 
-  void Queue_Probe::DequeueRequest(NvmTransaction* transaction)
+  void Queue_Probe::DequeueRequest(sim_time_type enqueue_time)
   {
-#if RUN_EXCEPTION_CHECK
-    if (transaction == nullptr)
-      throw std::logic_error("Object can not be null if accurateTimingEnabled=true");
-#endif
-
     nDepartures++;
     nDeparturesEpoch++;
 
-    sim_time_type et = currentObjectsInQueue[transaction];
-    currentObjectsInQueue.erase(transaction);
-    sim_time_type tc = Simulator->Time() - et;
+    sim_time_type tc = Simulator->Time() - enqueue_time;
     totalWaitingTime += tc;
     if (tc > maxWaitingTime)
       maxWaitingTime = tc;
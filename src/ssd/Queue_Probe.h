@@ -1,11 +1,9 @@
 #ifndef QUEUE_PROBE_H
 #define QUEUE_PROBE_H
 
-#include <unordered_map>
 #include <vector>
 #include <string>
 #include "../sim/Sim_Defs.h"
-#include "NvmTransaction.h"
 #include "../utils/XMLWriter.h"
 
 namespace SSD_Components
@@ -21,7 +19,6 @@ namespace SSD_Components
   class Queue_Probe
   {
   private:
-    typedef std::unordered_map<NvmTransaction*, sim_time_type> TransactionTimeMap;
     uint32_t count = 0;
     unsigned long nRequests = 0;
     unsigned long nDepartures = 0;
@@ -34,7 +31,6 @@ namespace SSD_Components
     sim_time_type epochStartTime;
     std::vector<StateStatistics> states;
     std::vector<StateStatistics> statesEpoch;
-    TransactionTimeMap currentObjectsInQueue;
     uint32_t maxQueueLength = 0;
     sim_time_type maxWaitingTime = 0;
 
@@ -42,8 +38,8 @@ namespace SSD_Components
 
   public:
     Queue_Probe();
-    void EnqueueRequest(NvmTransaction* transaction);
-    void DequeueRequest(NvmTransaction* transaction);
+    void EnqueueRequest();
+    void DequeueRequest(sim_time_type enqueue_time);
     void ResetEpochStatistics();
     void Snapshot(std::string id, Utils::XmlWriter& writer);
     unsigned long NRequests();
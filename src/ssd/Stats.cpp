@@ -1,5 +1,8 @@
 #include "Stats.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "../utils/InlineTools.h"
 
 using namespace SSD_Components;
@@ -59,6 +62,10 @@ Stats::Stats(const DeviceParameterSet& params)
     Total_wl_executions(0),
     Total_page_movements_for_gc(0),
     Total_page_movements_for_wl(0),
+    Total_host_page_programs(0),
+    Total_mapping_page_programs(0),
+    Total_gc_wl_page_programs(0),
+    Gc_latencies(),
 #ifdef GATHER_BLOCK_ERASE_HISTO
     Block_erase_histogram(
       params.Flash_Channel_Count,
@@ -79,3 +86,29 @@ Stats::Stats(const DeviceParameterSet& params)
     Total_gc_page_movements_per_stream { 0, },
     Total_wl_page_movements_per_stream { 0, }
 { }
+
+double
+Stats::avg_gc_latency() const
+{
+  double sum = 0;
+
+  for (auto latency : Gc_latencies)
+    sum += double(latency);
+
+  return Gc_latencies.empty() ? 0 : sum / double(Gc_latencies.size());
+}
+
+sim_time_type
+Stats::gc_latency_percentile(double percentile) const
+{
+  if (Gc_latencies.empty())
+    return 0;
+
+  auto rank = size_t(std::ceil(percentile / 100 * Gc_latencies.size()));
+  rank = std::min(std::max(rank, size_t(1)), Gc_latencies.size());
+
+  auto samples = Gc_latencies;
+  std::nth_element(samples.begin(), samples.begin() + (rank - 1), samples.end());
+
+  return samples[rank - 1];
+}
@@ -73,6 +73,16 @@ namespace SSD_Components
     uint32_t Total_page_movements_for_gc;
     uint32_t Total_page_movements_for_wl;
 
+    // Serviced flash page programs by their source, the write amplification
+    // is derived from them.
+    uint64_t Total_host_page_programs;
+    uint64_t Total_mapping_page_programs;
+    uint64_t Total_gc_wl_page_programs;
+
+    // Time from the GC victim selection to the end of its erase, for each
+    // GC execution
+    std::vector<sim_time_type> Gc_latencies;
+
 #ifdef GATHER_BLOCK_ERASE_HISTO
     BlockEraseHistoOnSSD Block_erase_histogram;
 #endif
@@ -88,6 +98,13 @@ namespace SSD_Components
 
     double avg_page_movement_for_gc() const;
     double avg_page_movement_for_wl() const;
+
+    double write_amplification() const;
+    double avg_gc_latency() const;
+
+    // Nearest rank percentile (0 < percentile <= 100) of the GC latencies,
+    // or 0 if no GC has been finished.
+    sim_time_type gc_latency_percentile(double percentile) const;
   };
 
   force_inline double
@@ -101,6 +118,15 @@ namespace SSD_Components
   {
     return double(Total_page_movements_for_wl) / double(Total_wl_executions);
   }
+
+  force_inline double
+  Stats::write_amplification() const
+  {
+    return double(Total_host_page_programs
+                    + Total_mapping_page_programs
+                    + Total_gc_wl_page_programs)
+             / double(Total_host_page_programs);
+  }
 }
 
 #endif // !STATS_H
@@ -0,0 +1,103 @@
+//
+// Telemetry
+// MQSim
+//
+
+#include "Telemetry.h"
+
+#include <algorithm>
+
+#include "../sim/Engine.h"
+
+using namespace SSD_Components;
+
+Telemetry::Telemetry(const std::string& file_path,
+                     sim_time_type sampling_period,
+                     FTL& ftl,
+                     Data_Cache_Manager_Base& cache_manager,
+                     uint32_t channel_count,
+                     uint32_t chip_no_per_channel)
+  : __ftl(ftl),
+    __cache_manager(cache_manager),
+    __channel_count(channel_count),
+    __chip_no_per_channel(chip_no_per_channel),
+    __out(file_path),
+    __pools(channel_count * chip_no_per_channel)
+{
+  if (!__out.is_open())
+    throw mqsim_error("Cannot open the telemetry file: " + file_path);
+
+  __write_header();
+
+  Simulator->Register_sampler([this](sim_time_type now) { Sample(now); },
+                              sampling_period);
+}
+
+void
+Telemetry::__write_header()
+{
+  __out << "Time_us,CMT_Entries,Cache_Dirty_Slots,Back_Pressure_Depth,"
+           "Free_Blocks,Min_Plane_Free_Blocks,Ongoing_Erases";
+
+  for (uint32_t channel = 0; channel < __channel_count; ++channel) {
+    for (uint32_t chip = 0; chip < __chip_no_per_channel; ++chip) {
+      std::string prefix = ",Ch" + std::to_string(channel)
+                             + "_Chip" + std::to_string(chip) + "_";
+
+      __out << prefix << "User_Read"
+            << prefix << "User_Write"
+            << prefix << "Mapping"
+            << prefix << "GC"
+            << prefix << "Free_Blocks"
+            << prefix << "Ongoing_Erases";
+    }
+  }
+
+  __out << '\n';
+}
+
+void
+Telemetry::Sample(sim_time_type now)
+{
+  uint32_t free_blocks = 0;
+  uint32_t min_plane_free_blocks = UINT32_MAX;
+  uint32_t ongoing_erases = 0;
+
+  auto pool = __pools.begin();
+
+  for (uint32_t channel = 0; channel < __channel_count; ++channel) {
+    for (uint32_t chip = 0; chip < __chip_no_per_channel; ++chip, ++pool) {
+      *pool = __ftl.block_pool_state(channel, chip);
+
+      free_blocks += pool->Free_blocks;
+      min_plane_free_blocks = std::min(min_plane_free_blocks,
+                                       pool->Min_plane_free_blocks);
+      ongoing_erases += pool->Ongoing_erases;
+    }
+  }
+
+  __out << now / NSEC_TO_USEC_COEFF
+        << ',' << __ftl.cmt_occupancy()
+        << ',' << __cache_manager.Get_dirty_slots_count()
+        << ',' << __cache_manager.Get_back_pressure_buffer_depth()
+        << ',' << free_blocks
+        << ',' << min_plane_free_blocks
+        << ',' << ongoing_erases;
+
+  pool = __pools.begin();
+
+  for (uint32_t channel = 0; channel < __channel_count; ++channel) {
+    for (uint32_t chip = 0; chip < __chip_no_per_channel; ++chip, ++pool) {
+      auto queues = __ftl.queue_lengths(channel, chip);
+
+      __out << ',' << queues.User_read
+            << ',' << queues.User_write
+            << ',' << queues.Mapping
+            << ',' << queues.GC
+            << ',' << pool->Free_blocks
+            << ',' << pool->Ongoing_erases;
+    }
+  }
+
+  __out << '\n';
+}
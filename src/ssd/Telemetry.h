@@ -0,0 +1,59 @@
+//
+// Telemetry
+// MQSim
+//
+
+#ifndef __MQSim__Telemetry__
+#define __MQSim__Telemetry__
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../sim/Sim_Defs.h"
+#include "dcm/Data_Cache_Manager_Base.h"
+#include "FTL.h"
+
+namespace SSD_Components {
+  // ------------------------------------------------------------------------
+  // Time series of the device internals.
+  //
+  // The engine calls the telemetry at every sampling period, and one CSV row
+  // is written per sample with the device wide values first:
+  //   Time_us, CMT_Entries, Cache_Dirty_Slots, Back_Pressure_Depth,
+  //   Free_Blocks, Min_Plane_Free_Blocks, Ongoing_Erases
+  // and then the values of each chip in the channel and chip order:
+  //   User_Read, User_Write, Mapping, GC (transaction queue lengths),
+  //   Free_Blocks, Ongoing_Erases
+  // ------------------------------------------------------------------------
+  class Telemetry {
+  private:
+    FTL&                     __ftl;
+    Data_Cache_Manager_Base& __cache_manager;
+
+    const uint32_t __channel_count;
+    const uint32_t __chip_no_per_channel;
+
+    std::ofstream __out;
+
+    // Scratch buffer of the chip block pools, in the channel and chip order
+    std::vector<ChipBlockPoolState> __pools;
+
+    void __write_header();
+
+  public:
+    Telemetry(const std::string& file_path,
+              sim_time_type sampling_period,
+              FTL& ftl,
+              Data_Cache_Manager_Base& cache_manager,
+              uint32_t channel_count,
+              uint32_t chip_no_per_channel);
+
+    void Sample(sim_time_type now);
+  };
+
+  typedef std::unique_ptr<Telemetry> TelemetryPtr;
+}
+
+#endif /* Predefined include guard __MQSim__Telemetry__ */
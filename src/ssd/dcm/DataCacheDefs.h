@@ -40,6 +40,12 @@ namespace SSD_Components {
     SHARED,//each application has access to the entire cache space
     EQUAL_PARTITIONING
   };
+
+  // Which cache slot is evicted when a new slot is required
+  enum class Cache_Eviction_Policy {
+    LRU,  // the least recently used slot
+    SLRU  // segmented LRU, slots hit twice are protected from one-time scans
+  };
 }
 
 force_inline std::string
@@ -77,6 +83,17 @@ to_string(SSD_Components::Cache_Sharing_Mode mode)
   }
 }
 
+force_inline std::string
+to_string(SSD_Components::Cache_Eviction_Policy policy)
+{
+  namespace sc = SSD_Components;
+
+  switch (policy) {
+  case sc::Cache_Eviction_Policy::LRU:  return "LRU";
+  case sc::Cache_Eviction_Policy::SLRU: return "SLRU";
+  }
+}
+
 force_inline SSD_Components::Caching_Mode
 to_caching_mode(std::string v)
 {
@@ -120,4 +137,18 @@ to_cache_sharing_mode(std::string v)
                     " configuration file");
 }
 
+force_inline SSD_Components::Cache_Eviction_Policy
+to_cache_eviction_policy(std::string v)
+{
+  namespace sc = SSD_Components;
+
+  Utils::to_upper(v);
+
+  if (v == "LRU")  return sc::Cache_Eviction_Policy::LRU;
+  if (v == "SLRU") return sc::Cache_Eviction_Policy::SLRU;
+
+  throw mqsim_error("Unknown data cache eviction policy specified in the SSD"
+                    " configuration file");
+}
+
 #endif /* Predefined include guard __MQSim__DataCacheDefs__ */
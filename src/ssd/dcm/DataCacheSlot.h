@@ -10,7 +10,6 @@
 #define __MQSim__DataCacheSlot__
 
 #include <cstdint>
-#include <list>
 
 #include "../../sim/Sim_Defs.h"
 #include "../../nvm_chip/flash_memory/FlashTypes.h"
@@ -31,9 +30,6 @@ namespace SSD_Components {
     data_cache_content_type Content;
     data_timestamp_type Timestamp;
     Cache_Slot_Status Status;
-
-    //used for fast implementation of LRU
-    std::list<std::pair<LPA_type, Data_Cache_Slot_Type*>>::iterator lru_list_ptr;
   };
 }
 
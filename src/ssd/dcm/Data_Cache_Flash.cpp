@@ -1,146 +1,323 @@
 #include "Data_Cache_Flash.h"
+#include <algorithm>
 #include <assert.h>
 
 
 namespace SSD_Components
 {
-  Data_Cache_Flash::Data_Cache_Flash(uint32_t capacity_in_pages) : capacity_in_pages(capacity_in_pages) {}
-  bool Data_Cache_Flash::Exists(const stream_id_type stream_id, const LPA_type lpn)
+  Data_Cache_Flash::Data_Cache_Flash(uint32_t capacity_in_pages, Cache_Eviction_Policy eviction_policy)
+    : __eviction_policy(eviction_policy),
+      __capacity(capacity_in_pages),
+      __protected_capacity(uint32_t(uint64_t(capacity_in_pages) * SLRU_PROTECTED_FIFTHS / 5)),
+      __slabs(),
+      __carved_slots(0),
+      __free_slots(NO_SLOT),
+      __index(),
+      __index_mask(0),
+      __index_shift(0),
+      __lists{ { NO_SLOT, NO_SLOT, 0 }, { NO_SLOT, NO_SLOT, 0 } },
+      __size(0),
+      __dirty_slots(0)
+  {
+    __index_resize(MIN_INDEX_SIZE);
+  }
+
+  uint32_t Data_Cache_Flash::__allocate_slot()
+  {
+    if (__free_slots != NO_SLOT) {
+      uint32_t slot = __free_slots;
+      __free_slots = __slot(slot).next;
+      return slot;
+    }
+
+    if ((__carved_slots & SLAB_MASK) == 0)
+      __slabs.emplace_back(new __Slot[std::min(SLAB_SIZE, __capacity - __carved_slots)]);
+
+    return __carved_slots++;
+  }
+
+  void Data_Cache_Flash::__release_slot(uint32_t slot)
+  {
+    __slot(slot).next = __free_slots;
+    __free_slots = slot;
+  }
+
+  uint32_t Data_Cache_Flash::__find_or_fail(LPA_type key) const
+  {
+    uint32_t slot = __find(key);
+    assert(slot != NO_SLOT);
+    return slot;
+  }
+
+  void Data_Cache_Flash::__index_insert(LPA_type key, uint32_t slot)
+  {
+    if (uint64_t(__size + 1) * 2 > __index.size())
+      __index_resize(__index.size() * 2);
+
+    uint64_t pos = __home_of(key);
+    while (__index[pos].slot != NO_SLOT)
+      pos = (pos + 1) & __index_mask;
+
+    __index[pos].key = key;
+    __index[pos].slot = slot;
+  }
+
+  void Data_Cache_Flash::__index_erase(LPA_type key)
+  {
+    uint64_t hole = __home_of(key);
+    while (__index[hole].key != key || __index[hole].slot == NO_SLOT)
+      hole = (hole + 1) & __index_mask;
+
+    // Backward shift the following entries of the probe sequence, so the
+    // lookups never need tombstones.
+    for (uint64_t pos = (hole + 1) & __index_mask;
+         __index[pos].slot != NO_SLOT;
+         pos = (pos + 1) & __index_mask) {
+      uint64_t home = __home_of(__index[pos].key);
+
+      if (((pos - home) & __index_mask) >= ((pos - hole) & __index_mask)) {
+        __index[hole] = __index[pos];
+        hole = pos;
+      }
+    }
+
+    __index[hole].slot = NO_SLOT;
+  }
+
+  void Data_Cache_Flash::__index_resize(uint64_t size)
+  {
+    std::vector<__Index_Entry> old(size, __Index_Entry{ 0, NO_SLOT });
+    old.swap(__index);
+
+    __index_mask = size - 1;
+    __index_shift = 64 - uint32_t(__builtin_ctzll(size));
+
+    for (auto& entry : old) {
+      if (entry.slot == NO_SLOT)
+        continue;
+
+      uint64_t pos = __home_of(entry.key);
+      while (__index[pos].slot != NO_SLOT)
+        pos = (pos + 1) & __index_mask;
+
+      __index[pos] = entry;
+    }
+  }
+
+  void Data_Cache_Flash::__link_front(uint32_t slot, __Segment segment)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    auto it = slots.find(key);
-    if (it == slots.end())
-      return false;
-    return true;
+    __Slot& s = __slot(slot);
+    __Recency_List& list = __lists[segment];
+
+    s.segment = segment;
+    s.prev = NO_SLOT;
+    s.next = list.head;
+
+    if (list.head != NO_SLOT)
+      __slot(list.head).prev = slot;
+    else
+      list.tail = slot;
+
+    list.head = slot;
+    list.size++;
   }
-  Data_Cache_Flash::~Data_Cache_Flash()
+
+  void Data_Cache_Flash::__unlink(uint32_t slot)
   {
-    for (auto &slot : slots)
-      delete slot.second;
+    __Slot& s = __slot(slot);
+    __Recency_List& list = __lists[s.segment];
+
+    if (s.prev != NO_SLOT)
+      __slot(s.prev).next = s.next;
+    else
+      list.head = s.next;
+
+    if (s.next != NO_SLOT)
+      __slot(s.next).prev = s.prev;
+    else
+      list.tail = s.prev;
+
+    list.size--;
+  }
+
+  void Data_Cache_Flash::__touch(uint32_t slot)
+  {
+    __Slot& s = __slot(slot);
+
+    if (__eviction_policy == Cache_Eviction_Policy::LRU) {
+      if (__lists[PROBATIONARY].head != slot) {
+        __unlink(slot);
+        __link_front(slot, PROBATIONARY);
+      }
+      return;
+    }
+
+    if (s.segment == PROTECTED && __lists[PROTECTED].head == slot)
+      return;
+
+    __unlink(slot);
+    __link_front(slot, PROTECTED);
+
+    if (__lists[PROTECTED].size > __protected_capacity) {
+      uint32_t demoted = __lists[PROTECTED].tail;
+      __unlink(demoted);
+      __link_front(demoted, PROBATIONARY);
+    }
+  }
+
+  uint32_t Data_Cache_Flash::__victim() const
+  {
+    if (__lists[PROBATIONARY].tail != NO_SLOT)
+      return __lists[PROBATIONARY].tail;
+    return __lists[PROTECTED].tail;
+  }
+
+  uint32_t Data_Cache_Flash::__next_victim(uint32_t slot) const
+  {
+    const __Slot& s = __slot(slot);
+
+    if (s.prev != NO_SLOT)
+      return s.prev;
+    if (s.segment == PROBATIONARY)
+      return __lists[PROTECTED].tail;
+    return NO_SLOT;
+  }
+
+  void Data_Cache_Flash::__insert(LPA_type key, const Data_Cache_Slot_Type& data)
+  {
+    if (__find(key) != NO_SLOT)
+      throw std::logic_error("Duplicate lpn insertion into data cache!");
+    if (__size >= __capacity)
+      throw std::logic_error("Data cache overfull!");
+
+    uint32_t slot = __allocate_slot();
+    __Slot& s = __slot(slot);
+    s.data = data;
+    s.key = key;
+
+    if (__is_dirty(data.Status))
+      __dirty_slots++;
+
+    __index_insert(key, slot);
+    __link_front(slot, PROBATIONARY);
+    __size++;
+  }
+
+  Data_Cache_Slot_Type Data_Cache_Flash::__evict(uint32_t slot)
+  {
+    __Slot& s = __slot(slot);
+    Data_Cache_Slot_Type evicted_item = s.data;
+
+    if (__is_dirty(evicted_item.Status))
+      __dirty_slots--;
+
+    __index_erase(s.key);
+    __unlink(slot);
+    __release_slot(slot);
+    __size--;
+
+    return evicted_item;
+  }
+
+  bool Data_Cache_Flash::Exists(const stream_id_type stream_id, const LPA_type lpn)
+  {
+    return __find(LPN_TO_UNIQUE_KEY(stream_id, lpn)) != NO_SLOT;
   }
   Data_Cache_Slot_Type Data_Cache_Flash::Get_slot(const stream_id_type stream_id, const LPA_type lpn)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    auto it = slots.find(key);
-    assert(it != slots.end());
-    if (lru_list.begin()->first != key)
-      lru_list.splice(lru_list.begin(), lru_list, it->second->lru_list_ptr);
-    return *(it->second);
+    uint32_t slot = __find_or_fail(LPN_TO_UNIQUE_KEY(stream_id, lpn));
+    __touch(slot);
+    return __slot(slot).data;
   }
   bool Data_Cache_Flash::Check_free_slot_availability()
   {
-    return slots.size() < capacity_in_pages;
+    return __size < __capacity;
   }
   bool Data_Cache_Flash::Check_free_slot_availability(uint32_t no_of_slots)
   {
-    return slots.size() + no_of_slots <= capacity_in_pages;
+    return __size + no_of_slots <= __capacity;
   }
   bool Data_Cache_Flash::Empty()
   {
-    return slots.size() == 0;
+    return __size == 0;
   }
   bool Data_Cache_Flash::Full()
   {
-    return slots.size() == capacity_in_pages;
+    return __size == __capacity;
+  }
+  uint32_t Data_Cache_Flash::Dirty_slots_count() const
+  {
+    return __dirty_slots;
   }
   Data_Cache_Slot_Type Data_Cache_Flash::Evict_one_dirty_slot()
   {
-    assert(slots.size() > 0);
-    auto itr = lru_list.rbegin();
-    while (itr != lru_list.rend())
+    assert(__size > 0);
+    uint32_t slot = __victim();
+    while (slot != NO_SLOT)
     {
-      if ((*itr).second->Status == Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK)
+      if (__slot(slot).data.Status == Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK)
         break;
-      itr++;
+      slot = __next_victim(slot);
     }
-    Data_Cache_Slot_Type evicted_item = *lru_list.back().second;
-    if (itr == lru_list.rend())
+    if (slot == NO_SLOT)
     {
+      Data_Cache_Slot_Type evicted_item = __slot(__victim()).data;
       evicted_item.Status = Cache_Slot_Status::EMPTY;
       return evicted_item;
     }
-    slots.erase(lru_list.back().first);
-    delete lru_list.back().second;
-    lru_list.pop_back();
-    return evicted_item;
+    return __evict(__victim());
   }
   Data_Cache_Slot_Type Data_Cache_Flash::Evict_one_slot_lru()
   {
-    assert(slots.size() > 0);
-    slots.erase(lru_list.back().first);
-    Data_Cache_Slot_Type evicted_item = *lru_list.back().second;
-    delete lru_list.back().second;
-    lru_list.pop_back();
-    return evicted_item;
+    assert(__size > 0);
+    return __evict(__victim());
   }
   void Data_Cache_Flash::Change_slot_status_to_writeback(const stream_id_type stream_id, const LPA_type lpn)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    auto it = slots.find(key);
-    assert(it != slots.end());
-    it->second->Status = Cache_Slot_Status::DIRTY_FLASH_WRITEBACK;
+    __Slot& s = __slot(__find_or_fail(LPN_TO_UNIQUE_KEY(stream_id, lpn)));
+    if (!__is_dirty(s.data.Status))
+      __dirty_slots++;
+    s.data.Status = Cache_Slot_Status::DIRTY_FLASH_WRITEBACK;
   }
   void Data_Cache_Flash::Insert_read_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content,
     const data_timestamp_type timestamp, const page_status_type state_bitmap_of_read_sectors)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    if (slots.find(key) != slots.end())
-      throw std::logic_error("Duplicate lpn insertion into data cache!");
-    if (slots.size() >= capacity_in_pages)
-      throw std::logic_error("Data cache overfull!");
-
-    Data_Cache_Slot_Type* cache_slot = new Data_Cache_Slot_Type();
-    cache_slot->LPA = lpn;
-    cache_slot->State_bitmap_of_existing_sectors = state_bitmap_of_read_sectors;
-    cache_slot->Content = content;
-    cache_slot->Timestamp = timestamp;
-    cache_slot->Status = Cache_Slot_Status::CLEAN;
-    lru_list.push_front(std::pair<LPA_type, Data_Cache_Slot_Type*>(key, cache_slot));
-    cache_slot->lru_list_ptr = lru_list.begin();
-    slots[key] = cache_slot;
+    Data_Cache_Slot_Type cache_slot;
+    cache_slot.LPA = lpn;
+    cache_slot.State_bitmap_of_existing_sectors = state_bitmap_of_read_sectors;
+    cache_slot.Content = content;
+    cache_slot.Timestamp = timestamp;
+    cache_slot.Status = Cache_Slot_Status::CLEAN;
+    __insert(LPN_TO_UNIQUE_KEY(stream_id, lpn), cache_slot);
   }
   void Data_Cache_Flash::Insert_write_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content,
     const data_timestamp_type timestamp, const page_status_type state_bitmap_of_write_sectors)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    if (slots.find(key) != slots.end())
-      throw std::logic_error("Duplicate lpn insertion into data cache!!");
-    if (slots.size() >= capacity_in_pages)
-      throw std::logic_error("Data cache overfull!");
-
-    Data_Cache_Slot_Type* cache_slot = new Data_Cache_Slot_Type();
-    cache_slot->LPA = lpn;
-    cache_slot->State_bitmap_of_existing_sectors = state_bitmap_of_write_sectors;
-    cache_slot->Content = content;
-    cache_slot->Timestamp = timestamp;
-    cache_slot->Status = Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK;
-    lru_list.push_front(std::pair<LPA_type, Data_Cache_Slot_Type*>(key, cache_slot));
-    cache_slot->lru_list_ptr = lru_list.begin();
-    slots[key] = cache_slot;
+    Data_Cache_Slot_Type cache_slot;
+    cache_slot.LPA = lpn;
+    cache_slot.State_bitmap_of_existing_sectors = state_bitmap_of_write_sectors;
+    cache_slot.Content = content;
+    cache_slot.Timestamp = timestamp;
+    cache_slot.Status = Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK;
+    __insert(LPN_TO_UNIQUE_KEY(stream_id, lpn), cache_slot);
   }
   void Data_Cache_Flash::Update_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content,
     const data_timestamp_type timestamp, const page_status_type state_bitmap_of_write_sectors)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    auto it = slots.find(key);
-    assert(it != slots.end());
+    uint32_t slot = __find_or_fail(LPN_TO_UNIQUE_KEY(stream_id, lpn));
+    __Slot& s = __slot(slot);
 
-    it->second->LPA = lpn;
-    it->second->State_bitmap_of_existing_sectors = state_bitmap_of_write_sectors;
-    it->second->Content = content;
-    it->second->Timestamp = timestamp;
-    it->second->Status = Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK;
-    if (lru_list.begin()->first != key)
-      lru_list.splice(lru_list.begin(), lru_list, it->second->lru_list_ptr);
+    s.data.LPA = lpn;
+    s.data.State_bitmap_of_existing_sectors = state_bitmap_of_write_sectors;
+    s.data.Content = content;
+    s.data.Timestamp = timestamp;
+    if (!__is_dirty(s.data.Status))
+      __dirty_slots++;
+    s.data.Status = Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK;
+    __touch(slot);
   }
   void Data_Cache_Flash::Remove_slot(const stream_id_type stream_id, const LPA_type lpn)
   {
-    LPA_type key = LPN_TO_UNIQUE_KEY(stream_id, lpn);
-    auto it = slots.find(key);
-    assert(it != slots.end());
-    lru_list.erase(it->second->lru_list_ptr);
-    delete it->second;
-    slots.erase(it);
-    //PRINT_MESSAGE("Remove, size is: " << slots.size());
+    __evict(__find_or_fail(LPN_TO_UNIQUE_KEY(stream_id, lpn)));
   }
-}
\ No newline at end of file
+}
@@ -1,31 +1,47 @@
 #ifndef DATA_CACHE_FLASH_H
 #define DATA_CACHE_FLASH_H
 
-#include <list>
+#include <memory>
 #include <queue>
-#include <unordered_map>
+#include <vector>
 #include "../../nvm_chip/flash_memory/FlashTypes.h"
 #include "../SSD_Defs.h"
+#include "DataCacheDefs.h"
 #include "Data_Cache_Manager_Base.h"
 #include "../NvmTransactionFlash.h"
 
 // Refined header list
 #include "DataCacheSlot.h"
 #include "../../utils/InlineTools.h"
-#include "../../utils/ObjectPool.h"
 
 namespace SSD_Components
 {
+  // --------------------------------------------------------------------------
+  // DRAM data cache of the flash pages.
+  //
+  // The slots are carved from fixed size slabs which are allocated on demand
+  // up to the capacity, and the released slots are recycled through a free
+  // list, so no slot is allocated one by one. The slots are indexed by the
+  // (stream, LPA) key in an open addressing hash table with linear probing,
+  // and are linked into the eviction order by their slab indices.
+  //
+  // With the LRU policy all slots are in one recency list. With the SLRU
+  // policy a new slot starts in the probationary segment and moves to the
+  // protected segment when it is hit. The protected segment is bounded, and
+  // its least recently used slot falls back to the probationary segment, so
+  // pages read or written only once are evicted first.
+  // --------------------------------------------------------------------------
   class Data_Cache_Flash
   {
   public:
-    Data_Cache_Flash(uint32_t capacity_in_pages = 0);
-    ~Data_Cache_Flash();
+    Data_Cache_Flash(uint32_t capacity_in_pages = 0,
+                     Cache_Eviction_Policy eviction_policy = Cache_Eviction_Policy::LRU);
     bool Exists(const stream_id_type streamID, const LPA_type lpn);
     bool Check_free_slot_availability();
     bool Check_free_slot_availability(uint32_t no_of_slots);
     bool Empty();
     bool Full();
+    uint32_t Dirty_slots_count() const;
     Data_Cache_Slot_Type Get_slot(const stream_id_type stream_id, const LPA_type lpn);
     Data_Cache_Slot_Type Evict_one_dirty_slot();
     Data_Cache_Slot_Type Evict_one_slot_lru();
@@ -34,11 +50,121 @@ namespace SSD_Components
     void Insert_read_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content, const data_timestamp_type timestamp, const page_status_type state_bitmap_of_read_sectors);
     void Insert_write_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content, const data_timestamp_type timestamp, const page_status_type state_bitmap_of_write_sectors);
     void Update_data(const stream_id_type stream_id, const LPA_type lpn, const data_cache_content_type content, const data_timestamp_type timestamp, const page_status_type state_bitmap_of_write_sectors);
+
   private:
-    std::unordered_map<LPA_type, Data_Cache_Slot_Type*> slots;
-    std::list<std::pair<LPA_type, Data_Cache_Slot_Type*>> lru_list;
-    uint32_t capacity_in_pages;
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    static constexpr uint32_t SLAB_SHIFT = 12;
+    static constexpr uint32_t SLAB_SIZE  = 1U << SLAB_SHIFT;
+    static constexpr uint32_t SLAB_MASK  = SLAB_SIZE - 1;
+
+    static constexpr uint32_t MIN_INDEX_SIZE = 1024;
+
+    // Share of the SLRU capacity kept for the protected segment, in fifths
+    static constexpr uint32_t SLRU_PROTECTED_FIFTHS = 4;
+
+    enum __Segment : uint8_t { PROBATIONARY = 0, PROTECTED = 1, SEGMENT_COUNT };
+
+    struct __Slot {
+      Data_Cache_Slot_Type data;
+      LPA_type key;
+      uint32_t prev;  // to the more recently used slot
+      uint32_t next;  // to the less recently used slot, or the next free one
+      __Segment segment;
+    };
+
+    struct __Recency_List {
+      uint32_t head;  // the most recently used slot
+      uint32_t tail;  // the least recently used slot
+      uint32_t size;
+    };
+
+    struct __Index_Entry {
+      LPA_type key;
+      uint32_t slot;
+    };
+
+    const Cache_Eviction_Policy __eviction_policy;
+    const uint32_t __capacity;
+    const uint32_t __protected_capacity;
+
+    std::vector<std::unique_ptr<__Slot[]>> __slabs;
+    uint32_t __carved_slots;
+    uint32_t __free_slots;
+
+    std::vector<__Index_Entry> __index;
+    uint64_t __index_mask;
+    uint32_t __index_shift;
+
+    __Recency_List __lists[SEGMENT_COUNT];
+    uint32_t __size;
+    uint32_t __dirty_slots;   // Slots whose data is not written to flash yet
+
+    static bool __is_dirty(const Cache_Slot_Status status);
+
+    __Slot& __slot(uint32_t slot);
+    const __Slot& __slot(uint32_t slot) const;
+
+    uint32_t __allocate_slot();
+    void __release_slot(uint32_t slot);
+
+    uint64_t __home_of(LPA_type key) const;
+    uint32_t __find(LPA_type key) const;
+    uint32_t __find_or_fail(LPA_type key) const;
+    void __index_insert(LPA_type key, uint32_t slot);
+    void __index_erase(LPA_type key);
+    void __index_resize(uint64_t size);
+
+    void __link_front(uint32_t slot, __Segment segment);
+    void __unlink(uint32_t slot);
+    void __touch(uint32_t slot);
+
+    uint32_t __victim() const;
+    uint32_t __next_victim(uint32_t slot) const;
+
+    void __insert(LPA_type key, const Data_Cache_Slot_Type& data);
+    Data_Cache_Slot_Type __evict(uint32_t slot);
   };
+
+  force_inline bool
+  Data_Cache_Flash::__is_dirty(const Cache_Slot_Status status)
+  {
+    return status == Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK
+      || status == Cache_Slot_Status::DIRTY_FLASH_WRITEBACK;
+  }
+
+  force_inline Data_Cache_Flash::__Slot&
+  Data_Cache_Flash::__slot(uint32_t slot)
+  {
+    return __slabs[slot >> SLAB_SHIFT][slot & SLAB_MASK];
+  }
+
+  force_inline const Data_Cache_Flash::__Slot&
+  Data_Cache_Flash::__slot(uint32_t slot) const
+  {
+    return __slabs[slot >> SLAB_SHIFT][slot & SLAB_MASK];
+  }
+
+  force_inline uint64_t
+  Data_Cache_Flash::__home_of(LPA_type key) const
+  {
+    // Fibonacci hashing spreads the sequential LPAs over the table
+    return (key * 0x9E3779B97F4A7C15ULL) >> __index_shift;
+  }
+
+  force_inline uint32_t
+  Data_Cache_Flash::__find(LPA_type key) const
+  {
+    for (uint64_t pos = __home_of(key); ; pos = (pos + 1) & __index_mask) {
+      const __Index_Entry& entry = __index[pos];
+
+      if (entry.slot == NO_SLOT)
+        return NO_SLOT;
+
+      if (entry.key == key)
+        return entry.slot;
+    }
+  }
 }
 
 #endif // !DATA_CACHE_FLASH_H
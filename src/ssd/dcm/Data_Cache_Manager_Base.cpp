@@ -96,9 +96,12 @@ SSD_Components::build_dcm_object(const sim_object_id_type& id,
       params.Data_Cache_DRAM_tCL,
       params.Data_Cache_DRAM_tRP,
       caching_modes.data(),
+      params.Data_Cache_Eviction_Policy,
       caching_modes.size(),
       params.Flash_Parameters.page_size_in_sector(),
-      params.back_pressure_buffer_max_depth()
+      params.back_pressure_buffer_max_depth(),
+      params.Data_Cache_Hot_Filter_Capacity,
+      params.Data_Cache_Hot_Filter_FP_Rate
     );
 
   case SSD_Components::Caching_Mechanism::ADVANCED:
@@ -116,9 +119,12 @@ SSD_Components::build_dcm_object(const sim_object_id_type& id,
       params.Data_Cache_DRAM_tRP,
       caching_modes.data(),
       params.Data_Cache_Sharing_Mode,
+      params.Data_Cache_Eviction_Policy,
       caching_modes.size(),
       params.Flash_Parameters.page_size_in_sector(),
-      params.back_pressure_buffer_max_depth()
+      params.back_pressure_buffer_max_depth(),
+      params.Data_Cache_Hot_Filter_Capacity,
+      params.Data_Cache_Hot_Filter_FP_Rate
     );
   }
 }
@@ -98,6 +98,11 @@ namespace SSD_Components
     void connect_host_interface(Host_Interface_Base& interface);
 
     virtual void Do_warmup(const Utils::WorkloadStatsList& workload_stats);
+
+    // Dirty slots in the DRAM cache and sectors waiting in the back pressure
+    // buffer, summed over all streams
+    virtual uint32_t Get_dirty_slots_count() const = 0;
+    virtual uint32_t Get_back_pressure_buffer_depth() const = 0;
   };
 
   force_inline void
@@ -4,7 +4,7 @@ using namespace SSD_Components;
 
 Data_Cache_Manager_Flash_Advanced::Data_Cache_Manager_Flash_Advanced(const sim_object_id_type& id,
                                                                      Host_Interface_Base* host_interface, NVM_Firmware* firmware, NVM_PHY_ONFI* flash_controller,
-                                                                     uint32_t total_capacity_in_bytes, uint32_t dram_row_size,
+                                                                     uint64_t total_capacity_in_bytes, uint32_t dram_row_size,
                                                                      uint32_t dram_data_rate,
                                                                      uint32_t dram_busrt_size,
                                                                      sim_time_type dram_tRCD,
@@ -12,9 +12,12 @@ Data_Cache_Manager_Flash_Advanced::Data_Cache_Manager_Flash_Advanced(const sim_o
                                                                      sim_time_type dram_tRP,
                                                                      Caching_Mode* caching_mode_per_input_stream,
                                                                      Cache_Sharing_Mode sharing_mode,
+                                                                     Cache_Eviction_Policy eviction_policy,
                                                                      uint32_t stream_count,
                                                                      uint32_t sector_no_per_page,
-                                                                     uint32_t back_pressure_buffer_max_depth)
+                                                                     uint32_t back_pressure_buffer_max_depth,
+                                                                     uint64_t hot_filter_capacity,
+                                                                     double hot_filter_false_positive_rate)
   : Data_Cache_Manager_Base(id,
                             host_interface,
                             firmware,
@@ -39,7 +42,7 @@ Data_Cache_Manager_Flash_Advanced::Data_Cache_Manager_Flash_Advanced(const sim_o
   {
   case SSD_Components::Cache_Sharing_Mode::SHARED:
   {
-    auto* sharedCache = new Data_Cache_Flash(capacity_in_pages);
+    auto* sharedCache = new Data_Cache_Flash(capacity_in_pages, eviction_policy);
     per_stream_cache = new Data_Cache_Flash*[stream_count];
     for (uint32_t i = 0; i < stream_count; i++)
       per_stream_cache[i] = sharedCache;
@@ -53,7 +56,7 @@ Data_Cache_Manager_Flash_Advanced::Data_Cache_Manager_Flash_Advanced(const sim_o
   case SSD_Components::Cache_Sharing_Mode::EQUAL_PARTITIONING:
     per_stream_cache = new Data_Cache_Flash*[stream_count];
     for (uint32_t i = 0; i < stream_count; i++)
-      per_stream_cache[i] = new Data_Cache_Flash(capacity_in_pages / stream_count);
+      per_stream_cache[i] = new Data_Cache_Flash(capacity_in_pages / stream_count, eviction_policy);
     dram_execution_queue = new std::queue<MemoryTransferInfo*>[stream_count];
     waiting_user_requests_queue_for_dram_free_slot = new std::list<UserRequest*>[stream_count];
     this->back_pressure_buffer_depth = new uint32_t[stream_count];
@@ -65,7 +68,9 @@ Data_Cache_Manager_Flash_Advanced::Data_Cache_Manager_Flash_Advanced(const sim_o
     break;
   }
 
-  bloom_filter = new std::set<LPA_type>[stream_count];
+  bloom_filter.assign(stream_count,
+                      Utils::CountingBloomFilter(hot_filter_capacity,
+                                                 hot_filter_false_positive_rate));
 }
 
 Data_Cache_Manager_Flash_Advanced::~Data_Cache_Manager_Flash_Advanced()
@@ -98,7 +103,6 @@ Data_Cache_Manager_Flash_Advanced::~Data_Cache_Manager_Flash_Advanced()
   delete per_stream_cache;
   delete[] dram_execution_queue;
   delete[] waiting_user_requests_queue_for_dram_free_slot;
-  delete[] bloom_filter;
 }
 
 void
@@ -237,7 +241,7 @@ Data_Cache_Manager_Flash_Advanced::write_to_destage_buffer(UserRequest& user_req
       per_stream_cache[tr->Stream_id]->Insert_write_data(tr->Stream_id, tr->LPA, tr->Content, tr->DataTimeStamp, tr->write_sectors_bitmap);
     }
     dram_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
-    if (bloom_filter[tr->Stream_id].find(tr->LPA) == bloom_filter[tr->Stream_id].end())//hot/cold data separation
+    if (!bloom_filter[tr->Stream_id].contains(tr->LPA))//hot/cold data separation
     {
       per_stream_cache[tr->Stream_id]->Change_slot_status_to_writeback(tr->Stream_id, tr->LPA); //Eagerly write back cold data
       flash_written_back_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
@@ -279,7 +283,7 @@ Data_Cache_Manager_Flash_Advanced::write_to_destage_buffer(UserRequest& user_req
 
   if (sim_time > next_bloom_filter_reset_milestone)//Reset control data structures used for hot/cold separation
   {
-    bloom_filter[user_request.Stream_id].clear();
+    bloom_filter[user_request.Stream_id].decay();
     next_bloom_filter_reset_milestone = sim_time + bloom_filter_reset_step;
   }
 }
@@ -647,3 +651,29 @@ Data_Cache_Manager_Flash_Advanced::Do_warmup(const Utils::WorkloadStatsList& wor
     break;
   }
 }
+
+uint32_t
+Data_Cache_Manager_Flash_Advanced::Get_dirty_slots_count() const
+{
+  // All streams point to the same cache in the shared mode
+  if (sharing_mode == Cache_Sharing_Mode::SHARED)
+    return per_stream_cache[0]->Dirty_slots_count();
+
+  uint32_t dirty_slots = 0;
+
+  for (uint32_t i = 0; i < stream_count; i++)
+    dirty_slots += per_stream_cache[i]->Dirty_slots_count();
+
+  return dirty_slots;
+}
+
+uint32_t
+Data_Cache_Manager_Flash_Advanced::Get_back_pressure_buffer_depth() const
+{
+  uint32_t depth = 0;
+
+  for (uint32_t i = 0; i < (shared_dram_request_queue ? 1 : stream_count); i++)
+    depth += back_pressure_buffer_depth[i];
+
+  return depth;
+}
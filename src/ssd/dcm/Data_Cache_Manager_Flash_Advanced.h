@@ -9,6 +9,7 @@
 #include "Data_Cache_Manager_Base.h"
 #include "Data_Cache_Flash.h"
 #include "../NvmTransactionFlash.h"
+#include "../../utils/CountingBloomFilter.h"
 
 namespace SSD_Components
 {
@@ -43,7 +44,8 @@ namespace SSD_Components
   {
   private:
     NVM_PHY_ONFI * flash_controller;
-    uint32_t capacity_in_bytes, capacity_in_pages;
+    uint64_t capacity_in_bytes;
+    uint32_t capacity_in_pages;
     Data_Cache_Flash** per_stream_cache;
     bool memory_channel_is_busy;
     
@@ -57,7 +59,8 @@ namespace SSD_Components
     int dram_execution_list_turn;
     uint32_t back_pressure_buffer_max_depth;
     uint32_t *back_pressure_buffer_depth;
-    std::set<LPA_type>* bloom_filter;
+    // Recently written LPAs, to write back cold data eagerly
+    std::vector<Utils::CountingBloomFilter> bloom_filter;
     sim_time_type bloom_filter_reset_step = 1000000000;
     sim_time_type next_bloom_filter_reset_milestone = 0;
 
@@ -78,7 +81,7 @@ namespace SSD_Components
                                       Host_Interface_Base* host_interface,
                                       NVM_Firmware* firmware,
                                       NVM_PHY_ONFI* flash_controller,
-                                      uint32_t total_capacity_in_bytes,
+                                      uint64_t total_capacity_in_bytes,
                                       uint32_t dram_row_size,
                                       uint32_t dram_data_rate,
                                       uint32_t dram_busrt_size,
@@ -87,15 +90,21 @@ namespace SSD_Components
                                       sim_time_type dram_tRP,
                                       Caching_Mode* caching_mode_per_input_stream,
                                       Cache_Sharing_Mode sharing_mode,
+                                      Cache_Eviction_Policy eviction_policy,
                                       uint32_t stream_count,
                                       uint32_t sector_no_per_page,
-                                      uint32_t back_pressure_buffer_max_depth);
+                                      uint32_t back_pressure_buffer_max_depth,
+                                      uint64_t hot_filter_capacity,
+                                      double hot_filter_false_positive_rate);
     ~Data_Cache_Manager_Flash_Advanced() final;
 
     void Execute_simulator_event(MQSimEngine::SimEvent* ev) final;
     void Setup_triggers() final;
     void Do_warmup(const Utils::WorkloadStatsList& workload_stats) final;
 
+    uint32_t Get_dirty_slots_count() const final;
+    uint32_t Get_back_pressure_buffer_depth() const final;
+
   };
 }
 #endif // !DATA_CACHE_MANAGER_FLASH_ADVANCED_H
@@ -6,7 +6,7 @@ Data_Cache_Manager_Flash_Simple::Data_Cache_Manager_Flash_Simple(const sim_objec
                                                                  Host_Interface_Base* host_interface,
                                                                  NVM_Firmware* firmware,
                                                                  NVM_PHY_ONFI* flash_controller,
-                                                                 uint32_t total_capacity_in_bytes,
+                                                                 uint64_t total_capacity_in_bytes,
                                                                  uint32_t dram_row_size,
                                                                  uint32_t dram_data_rate,
                                                                  uint32_t dram_busrt_size,
@@ -14,9 +14,12 @@ Data_Cache_Manager_Flash_Simple::Data_Cache_Manager_Flash_Simple(const sim_objec
                                                                  sim_time_type dram_tCL,
                                                                  sim_time_type dram_tRP,
                                                                  Caching_Mode* caching_mode_per_input_stream,
+                                                                 Cache_Eviction_Policy eviction_policy,
                                                                  uint32_t stream_count,
                                                                  uint32_t sector_no_per_page,
-                                                                 uint32_t back_pressure_buffer_max_depth)
+                                                                 uint32_t back_pressure_buffer_max_depth,
+                                                                 uint64_t hot_filter_capacity,
+                                                                 double hot_filter_false_positive_rate)
   : Data_Cache_Manager_Base(id,
                             host_interface,
                             firmware,
@@ -36,11 +39,13 @@ Data_Cache_Manager_Flash_Simple::Data_Cache_Manager_Flash_Simple(const sim_objec
     __user_transaction_handler(this, &Data_Cache_Manager_Flash_Simple::__handle_transaction_service)
 {
   capacity_in_pages = capacity_in_bytes / (SECTOR_SIZE_IN_BYTE * sector_no_per_page);
-  data_cache = new Data_Cache_Flash(capacity_in_pages);
+  data_cache = new Data_Cache_Flash(capacity_in_pages, eviction_policy);
   dram_execution_queue = new std::queue<MemoryTransferInfo*>[stream_count];
   waiting_user_requests_queue_for_dram_free_slot = new std::list<UserRequest*>[stream_count];
   this->back_pressure_buffer_depth = 0;
-  bloom_filter = new std::set<LPA_type>[stream_count];
+  bloom_filter.assign(1,
+                      Utils::CountingBloomFilter(hot_filter_capacity,
+                                                 hot_filter_false_positive_rate));
 }
 
 Data_Cache_Manager_Flash_Simple::~Data_Cache_Manager_Flash_Simple()
@@ -55,7 +60,6 @@ Data_Cache_Manager_Flash_Simple::~Data_Cache_Manager_Flash_Simple()
   delete data_cache;
   delete[] dram_execution_queue;
   delete[] waiting_user_requests_queue_for_dram_free_slot;
-  delete[] bloom_filter;
 }
 
 void
@@ -189,7 +193,7 @@ Data_Cache_Manager_Flash_Simple::write_to_destage_buffer(UserRequest& user_reque
       data_cache->Insert_write_data(tr->Stream_id, tr->LPA, tr->Content, tr->DataTimeStamp, tr->write_sectors_bitmap);
     }
     dram_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
-    if (bloom_filter[0].find(tr->LPA) == bloom_filter[0].end())//hot/cold data separation
+    if (!bloom_filter[0].contains(tr->LPA))//hot/cold data separation
     {
       data_cache->Change_slot_status_to_writeback(tr->Stream_id, tr->LPA); //Eagerly write back cold data
       flash_written_back_write_size_in_sectors += count_sector_no_from_status_bitmap(tr->write_sectors_bitmap);
@@ -231,7 +235,7 @@ Data_Cache_Manager_Flash_Simple::write_to_destage_buffer(UserRequest& user_reque
 
   if (sim_time > next_bloom_filter_reset_milestone)//Reset control data structures used for hot/cold separation
   {
-    bloom_filter[0].clear();
+    bloom_filter[0].decay();
     next_bloom_filter_reset_milestone = sim_time + bloom_filter_reset_step;
   }
 }
@@ -371,3 +375,15 @@ Data_Cache_Manager_Flash_Simple::Setup_triggers()
 
   flash_controller->connect_to_transaction_service_signal(__user_transaction_handler);
 }
+
+uint32_t
+Data_Cache_Manager_Flash_Simple::Get_dirty_slots_count() const
+{
+  return data_cache->Dirty_slots_count();
+}
+
+uint32_t
+Data_Cache_Manager_Flash_Simple::Get_back_pressure_buffer_depth() const
+{
+  return back_pressure_buffer_depth;
+}
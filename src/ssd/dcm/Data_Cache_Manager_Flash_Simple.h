@@ -9,6 +9,7 @@
 #include "Data_Cache_Manager_Base.h"
 #include "Data_Cache_Flash.h"
 #include "../NvmTransactionFlash.h"
+#include "../../utils/CountingBloomFilter.h"
 
 namespace SSD_Components
 {
@@ -16,7 +17,8 @@ namespace SSD_Components
   {
   private:
     NVM_PHY_ONFI * flash_controller;
-    uint32_t capacity_in_bytes, capacity_in_pages;
+    uint64_t capacity_in_bytes;
+    uint32_t capacity_in_pages;
     Data_Cache_Flash* data_cache;
 
     // The list of DRAM transfers that are waiting to be executed
@@ -28,7 +30,8 @@ namespace SSD_Components
     int request_queue_turn;
     uint32_t back_pressure_buffer_max_depth;
     uint32_t back_pressure_buffer_depth;
-    std::set<LPA_type>* bloom_filter;
+    // Recently written LPAs, to write back cold data eagerly
+    std::vector<Utils::CountingBloomFilter> bloom_filter;
     sim_time_type bloom_filter_reset_step = 1000000000;
     sim_time_type next_bloom_filter_reset_milestone = 0;
 
@@ -49,7 +52,7 @@ namespace SSD_Components
                                     Host_Interface_Base* host_interface,
                                     NVM_Firmware* firmware,
                                     NVM_PHY_ONFI* flash_controller,
-                                    uint32_t total_capacity_in_bytes,
+                                    uint64_t total_capacity_in_bytes,
                                     uint32_t dram_row_size,
                                     uint32_t dram_data_rate,
                                     uint32_t dram_busrt_size,
@@ -57,13 +60,19 @@ namespace SSD_Components
                                     sim_time_type dram_tCL,
                                     sim_time_type dram_tRP,
                                     Caching_Mode* caching_mode_per_input_stream,
+                                    Cache_Eviction_Policy eviction_policy,
                                     uint32_t stream_count,
                                     uint32_t sector_no_per_page,
-                                    uint32_t back_pressure_buffer_max_depth);
+                                    uint32_t back_pressure_buffer_max_depth,
+                                    uint64_t hot_filter_capacity,
+                                    double hot_filter_false_positive_rate);
     ~Data_Cache_Manager_Flash_Simple() final;
 
     void Execute_simulator_event(MQSimEngine::SimEvent* ev) final;
     void Setup_triggers() final;
+
+    uint32_t Get_dirty_slots_count() const final;
+    uint32_t Get_back_pressure_buffer_depth() const final;
   };
 }
 #endif // !DATA_CACHE_MANAGER_FLASH_SIMPLE_H
@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include "../../nvm_chip/flash_memory/FlashTypes.h"
+#include "../../sim/Sim_Defs.h"
 
 namespace SSD_Components {
   class NvmTransactionFlashER;
@@ -61,6 +62,13 @@ namespace SSD_Components {
     int Ongoing_user_program_count;
     int Ongoing_user_read_count;
 
+    // Time of the last page program, the age of a block is measured from it
+    // by the cost-benefit style GC policies.
+    sim_time_type Last_write_time;
+
+    // Time the block was selected as a GC victim, or INVALID_TIME
+    sim_time_type Gc_start_time;
+
   public:
     Block_Pool_Slot_Type(uint32_t block_id, uint32_t pages_no_per_block);
 
@@ -93,7 +101,9 @@ namespace SSD_Components {
       Erase_transaction(nullptr),
       Hot_block(false),
       Ongoing_user_program_count(0),
-      Ongoing_user_read_count(0)
+      Ongoing_user_read_count(0),
+      Last_write_time(0),
+      Gc_start_time(INVALID_TIME)
   { }
 
   force_inline void
@@ -107,6 +117,7 @@ namespace SSD_Components {
     Stream_id = NO_STREAM;
     Holds_mapping_data = false;
     Erase_transaction = nullptr;
+    Gc_start_time = INVALID_TIME;
   }
 
 }
@@ -0,0 +1,209 @@
+//
+// BlockVictimIndex
+// MQSim
+//
+
+#ifndef __MQSim__BlockVictimIndex__
+#define __MQSim__BlockVictimIndex__
+
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "BlockPoolSlotType.h"
+
+namespace SSD_Components {
+  // ------------------------------------------------------------------------
+  // Incremental GC/WL victim index of a plane.
+  //
+  // Fully written blocks are bucketed by their invalid page count, so the
+  // greedy selection starts from the highest non empty bucket instead of
+  // scanning the whole plane. All blocks are also ordered by their erase
+  // count for the wear-leveling queries. Ties are broken by the lowest block
+  // id in both cases, which is the order the former linear scans chose.
+  // ------------------------------------------------------------------------
+  class BlockVictimIndex {
+  public:
+    static constexpr flash_block_ID_type NO_BLOCK = UINT32_MAX;
+
+  private:
+    static constexpr uint32_t NOT_INDEXED = UINT32_MAX;
+
+    typedef std::set<flash_block_ID_type>              BlockIdSet;
+    typedef std::pair<uint32_t, flash_block_ID_type>   WearKey;
+
+    struct __more_worn_first {
+      bool operator()(const WearKey& a, const WearKey& b) const
+      {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+      }
+    };
+
+    const uint32_t __pages_no_per_block;
+
+    std::vector<BlockIdSet> __invalid_buckets;
+    std::vector<uint32_t>   __indexed_bucket;
+    uint32_t                __top_bucket;
+
+    std::set<WearKey>                    __least_worn;
+    std::set<WearKey, __more_worn_first> __most_worn;
+
+    void __unlink(flash_block_ID_type block_id);
+
+  public:
+    BlockVictimIndex(uint32_t block_no_per_plane, uint32_t pages_no_per_block);
+
+    // Places the block in the bucket of its current invalid page count if it
+    // is fully written, or drops it from the buckets otherwise. It should be
+    // called after a page of the block is written or invalidated.
+    void Update(const Block_Pool_Slot_Type& block);
+
+    // Wraps the erase count change of a block being erased.
+    void Erase_started(const Block_Pool_Slot_Type& block);
+    void Erase_finished(const Block_Pool_Slot_Type& block);
+
+    // Recreates the whole index from the block records, i.e. after the
+    // bookkeeping is restored from a checkpoint.
+    void Rebuild(const BlockPoolSlotList& blocks);
+
+    // Returns the fully written block with the most invalid pages which
+    // satisfies the given filter, or NO_BLOCK.
+    template <typename Filter>
+    flash_block_ID_type Most_invalidated(Filter&& is_candidate);
+
+    // Visits the fully written blocks from the most invalidated ones, in the
+    // block id order within the same invalid page count.
+    template <typename Visitor>
+    void For_each_full_block(Visitor&& visit) const;
+
+    flash_block_ID_type Least_worn() const;
+    flash_block_ID_type Most_worn() const;
+  };
+
+  force_inline
+  BlockVictimIndex::BlockVictimIndex(uint32_t block_no_per_plane,
+                                     uint32_t pages_no_per_block)
+    : __pages_no_per_block(pages_no_per_block),
+      __invalid_buckets(pages_no_per_block + 1),
+      __indexed_bucket(block_no_per_plane, uint32_t(NOT_INDEXED)),
+      __top_bucket(0)
+  {
+    for (flash_block_ID_type id = 0; id < block_no_per_plane; ++id) {
+      __least_worn.emplace(0, id);
+      __most_worn.emplace(0, id);
+    }
+  }
+
+  force_inline void
+  BlockVictimIndex::__unlink(flash_block_ID_type block_id)
+  {
+    uint32_t& bucket = __indexed_bucket[block_id];
+
+    if (bucket == NOT_INDEXED)
+      return;
+
+    __invalid_buckets[bucket].erase(block_id);
+    bucket = NOT_INDEXED;
+  }
+
+  force_inline void
+  BlockVictimIndex::Update(const Block_Pool_Slot_Type& block)
+  {
+    if (block.Current_page_write_index != __pages_no_per_block) {
+      __unlink(block.BlockID);
+      return;
+    }
+
+    if (__indexed_bucket[block.BlockID] == block.Invalid_page_count)
+      return;
+
+    __unlink(block.BlockID);
+
+    __invalid_buckets[block.Invalid_page_count].insert(block.BlockID);
+    __indexed_bucket[block.BlockID] = block.Invalid_page_count;
+
+    if (__top_bucket < block.Invalid_page_count)
+      __top_bucket = block.Invalid_page_count;
+  }
+
+  force_inline void
+  BlockVictimIndex::Erase_started(const Block_Pool_Slot_Type& block)
+  {
+    __unlink(block.BlockID);
+
+    __least_worn.erase(WearKey(block.Erase_count, block.BlockID));
+    __most_worn.erase(WearKey(block.Erase_count, block.BlockID));
+  }
+
+  force_inline void
+  BlockVictimIndex::Erase_finished(const Block_Pool_Slot_Type& block)
+  {
+    __least_worn.emplace(block.Erase_count, block.BlockID);
+    __most_worn.emplace(block.Erase_count, block.BlockID);
+  }
+
+  force_inline void
+  BlockVictimIndex::Rebuild(const BlockPoolSlotList& blocks)
+  {
+    for (auto& bucket : __invalid_buckets)
+      bucket.clear();
+
+    __indexed_bucket.assign(__indexed_bucket.size(), uint32_t(NOT_INDEXED));
+    __top_bucket = 0;
+
+    __least_worn.clear();
+    __most_worn.clear();
+
+    for (auto& block : blocks) {
+      Update(block);
+      Erase_finished(block);
+    }
+  }
+
+  template <typename Filter>
+  force_inline flash_block_ID_type
+  BlockVictimIndex::Most_invalidated(Filter&& is_candidate)
+  {
+    // Blocks without invalid pages are never worth to collect, so the bucket
+    // 0 is not visited.
+    for (uint32_t bucket = __top_bucket; 0 < bucket; --bucket) {
+      auto& blocks = __invalid_buckets[bucket];
+
+      if (blocks.empty()) {
+        if (bucket == __top_bucket)
+          --__top_bucket;
+        continue;
+      }
+
+      for (auto block_id : blocks)
+        if (is_candidate(block_id))
+          return block_id;
+    }
+
+    return NO_BLOCK;
+  }
+
+  template <typename Visitor>
+  force_inline void
+  BlockVictimIndex::For_each_full_block(Visitor&& visit) const
+  {
+    for (uint32_t bucket = __top_bucket + 1; 0 < bucket; --bucket)
+      for (auto block_id : __invalid_buckets[bucket - 1])
+        visit(block_id);
+  }
+
+  force_inline flash_block_ID_type
+  BlockVictimIndex::Least_worn() const
+  {
+    return __least_worn.begin()->second;
+  }
+
+  force_inline flash_block_ID_type
+  BlockVictimIndex::Most_worn() const
+  {
+    return __most_worn.begin()->second;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__BlockVictimIndex__ */
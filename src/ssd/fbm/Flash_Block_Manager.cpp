@@ -1,6 +1,7 @@
 #include "Flash_Block_Manager.h"
 
 #include "../../nvm_chip/flash_memory/Physical_Page_Address.h"
+#include "../../sim/Engine.h"
 #include "../Stats.h"
 #include "../gc_and_wl/GC_and_WL_Unit_Base.h"
 
@@ -28,9 +29,11 @@ namespace SSD_Components
     plane_record->Free_pages_count--;    
     page_address.BlockID = plane_record->Data_wf[stream_id]->BlockID;
     page_address.PageID = plane_record->Data_wf[stream_id]->Current_page_write_index++;
+    plane_record->Data_wf[stream_id]->Last_write_time = Simulator->Time();
     program_transaction_issued(page_address);
     if(plane_record->Data_wf[stream_id]->Current_page_write_index == pages_no_per_block)//The current write frontier block is written to the end
     {
+      plane_record->Victim_index.Update(*plane_record->Data_wf[stream_id]);
       plane_record->Data_wf[stream_id] = plane_record->Get_a_free_block(stream_id, false);
       gc_and_wl_unit->Check_gc_required(plane_record->Get_free_block_pool_size(), page_address);
     }
@@ -45,10 +48,12 @@ namespace SSD_Components
     plane_record->Free_pages_count--;    
     page_address.BlockID = plane_record->GC_wf[stream_id]->BlockID;
     page_address.PageID = plane_record->GC_wf[stream_id]->Current_page_write_index++;
+    plane_record->GC_wf[stream_id]->Last_write_time = Simulator->Time();
 
     //The current write frontier block is written to the end
     if (plane_record->GC_wf[stream_id]->Current_page_write_index == pages_no_per_block) {
       //Assign a new write frontier block
+      plane_record->Victim_index.Update(*plane_record->GC_wf[stream_id]);
       plane_record->GC_wf[stream_id] = plane_record->Get_a_free_block(stream_id, false);
 
       gc_and_wl_unit->Check_gc_required(plane_record->Get_free_block_pool_size(), page_address);
@@ -73,6 +78,7 @@ namespace SSD_Components
       plane_record->Free_pages_count--;
       page_addresses[i].BlockID = plane_record->Data_wf[stream_id]->BlockID;
       page_addresses[i].PageID = plane_record->Data_wf[stream_id]->Current_page_write_index++;
+      plane_record->Data_wf[stream_id]->Last_write_time = Simulator->Time();
       plane_record->Check_bookkeeping_correctness(page_addresses[i]);
     }
 
@@ -88,6 +94,7 @@ namespace SSD_Components
     }
 
     //Update the write frontier
+    plane_record->Victim_index.Update(*plane_record->Data_wf[stream_id]);
     plane_record->Data_wf[stream_id] = plane_record->Get_a_free_block(stream_id, false);
   }
 
@@ -98,9 +105,11 @@ namespace SSD_Components
     plane_record->Free_pages_count--;
     page_address.BlockID = plane_record->Translation_wf[streamID]->BlockID;
     page_address.PageID = plane_record->Translation_wf[streamID]->Current_page_write_index++;
+    plane_record->Translation_wf[streamID]->Last_write_time = Simulator->Time();
     program_transaction_issued(page_address);
     if (plane_record->Translation_wf[streamID]->Current_page_write_index == pages_no_per_block)//The current write frontier block for translation pages is written to the end
     {
+      plane_record->Victim_index.Update(*plane_record->Translation_wf[streamID]);
       plane_record->Translation_wf[streamID] = plane_record->Get_a_free_block(streamID, true);//Assign a new write frontier block
       if (!is_for_gc)
         gc_and_wl_unit->Check_gc_required(plane_record->Get_free_block_pool_size(), page_address);
@@ -117,6 +126,7 @@ namespace SSD_Components
       PRINT_ERROR("Inconsistent status in the Invalidate_page_in_block function! The accessed block is not allocated to stream " << stream_id)
     plane_record->Blocks[page_address.BlockID].Invalid_page_count++;
     plane_record->Blocks[page_address.BlockID].Invalid_page_bitmap[page_address.PageID / 64] |= ((uint64_t)0x1) << (page_address.PageID % 64);
+    plane_record->Victim_index.Update(plane_record->Blocks[page_address.BlockID]);
   }
 
   inline void Flash_Block_Manager::Invalidate_page_in_block_for_preconditioning(const stream_id_type stream_id, const NVM::FlashMemory::Physical_Page_Address& page_address)
@@ -127,6 +137,7 @@ namespace SSD_Components
       PRINT_ERROR("Inconsistent status in the Invalidate_page_in_block function! The accessed block is not allocated to stream " << stream_id)
       plane_record->Blocks[page_address.BlockID].Invalid_page_count++;
     plane_record->Blocks[page_address.BlockID].Invalid_page_bitmap[page_address.PageID / 64] |= ((uint64_t)0x1) << (page_address.PageID % 64);
+    plane_record->Victim_index.Update(plane_record->Blocks[page_address.BlockID]);
   }
 
   void Flash_Block_Manager::Add_erased_block_to_pool(const NVM::FlashMemory::Physical_Page_Address& block_address)
@@ -138,10 +149,10 @@ namespace SSD_Components
 
 #ifdef GATHER_BLOCK_ERASE_HISTO
     _stats.Block_erase_histogram[block_address.ChannelID][block_address.ChipID][block_address.DieID][block_address.PlaneID][block.Erase_count]--;
-    block.Erase();
+    plane_record.Erase_block(block);
     _stats.Block_erase_histogram[block_address.ChannelID][block_address.ChipID][block_address.DieID][block_address.PlaneID][block.Erase_count]++;
 #else
-    block.Erase();
+    plane_record.Erase_block(block);
 #endif
     plane_record.Add_to_free_block_pool(block, gc_and_wl_unit->Use_dynamic_wearleveling());
     plane_record.Check_bookkeeping_correctness(block_address);
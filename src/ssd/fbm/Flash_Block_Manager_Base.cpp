@@ -5,6 +5,25 @@
 
 using namespace SSD_Components;
 
+namespace {
+  force_inline void
+  __save_block_ids(Utils::CheckpointWriter& writer,
+                   const BlockPoolSlotPtrList& blocks)
+  {
+    for (auto* block : blocks)
+      writer.write(block->BlockID);
+  }
+
+  force_inline void
+  __load_block_ids(Utils::CheckpointReader& reader,
+                   PlaneBookKeepingType& plane,
+                   BlockPoolSlotPtrList& blocks)
+  {
+    for (auto& block : blocks)
+      block = &plane.Blocks.at(reader.read<flash_block_ID_type>());
+  }
+}
+
 Flash_Block_Manager_Base::Flash_Block_Manager_Base(GC_and_WL_Unit_Base* gc_and_wl_unit,
                                                    Stats& stats,
                                                    uint32_t max_allowed_block_erase_count,
@@ -57,31 +76,14 @@ void Flash_Block_Manager_Base::Set_GC_and_WL_Unit(GC_and_WL_Unit_Base* gcwl) { t
 
 uint32_t Flash_Block_Manager_Base::Get_min_max_erase_difference(const NVM::FlashMemory::Physical_Page_Address& plane_address)
 {
-  uint32_t min_erased_block = 0;
-  uint32_t max_erased_block = 0;
-  PlaneBookKeepingType *plane_record = &plane_manager[plane_address.ChannelID][plane_address.ChipID][plane_address.DieID][plane_address.PlaneID];
+  auto& victim_index = Get_plane_bookkeeping_entry(plane_address).Victim_index;
 
-  for (uint32_t i = 1; i < block_no_per_plane; i++)
-  {
-    if (plane_record->Blocks[i].Erase_count > plane_record->Blocks[max_erased_block].Erase_count)
-      max_erased_block = i;
-    if (plane_record->Blocks[i].Erase_count < plane_record->Blocks[min_erased_block].Erase_count)
-      min_erased_block = i;
-  }
-  return max_erased_block - min_erased_block;
+  return victim_index.Most_worn() - victim_index.Least_worn();
 }
 
 flash_block_ID_type Flash_Block_Manager_Base::Get_coldest_block_id(const NVM::FlashMemory::Physical_Page_Address& plane_address)
 {
-  uint32_t min_erased_block = 0;
-  PlaneBookKeepingType *plane_record = &plane_manager[plane_address.ChannelID][plane_address.ChipID][plane_address.DieID][plane_address.PlaneID];
-
-  for (uint32_t i = 1; i < block_no_per_plane; i++)
-  {
-    if (plane_record->Blocks[i].Erase_count < plane_record->Blocks[min_erased_block].Erase_count)
-      min_erased_block = i;
-  }
-  return min_erased_block;
+  return Get_plane_bookkeeping_entry(plane_address).Victim_index.Least_worn();
 }
 
 bool Flash_Block_Manager_Base::Block_has_ongoing_gc_wl(const NVM::FlashMemory::Physical_Page_Address& block_address)
@@ -143,6 +145,119 @@ bool Flash_Block_Manager_Base::Is_page_valid(const Block_Pool_Slot_Type& block,
   return ((block.Invalid_page_bitmap[page_id / 64] & (((uint64_t)1) << page_id)) == 0);
 }
 
+void
+Flash_Block_Manager_Base::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  writer.write_section("FBM");
+  writer.write(total_concurrent_streams_no);
+
+  for (auto& channel : plane_manager)
+    for (auto& chip : channel)
+      for (auto& die : chip)
+        for (auto& plane : die) {
+          if (!plane.Ongoing_erase_operations.empty())
+            throw mqsim_error("Cannot take a checkpoint while GC/WL erase "
+                              "operations are in progress");
+
+          writer.write(plane.Total_pages_count);
+          writer.write(plane.Free_pages_count);
+          writer.write(plane.Valid_pages_count);
+          writer.write(plane.Invalid_pages_count);
+
+          writer.write<uint32_t>(plane.Blocks.size());
+
+          for (auto& block : plane.Blocks) {
+            if (block.Has_ongoing_gc_wl || block.Erase_transaction != nullptr)
+              throw mqsim_error("Cannot take a checkpoint while GC/WL erase "
+                                "operations are in progress");
+
+            writer.write(block.Current_page_write_index);
+            writer.write(block.Current_status);
+            writer.write(block.Erase_count);
+            writer.write(block.Invalid_page_count);
+            writer.write_vector(block.Invalid_page_bitmap);
+            writer.write(block.Stream_id);
+            writer.write(block.Holds_mapping_data);
+            writer.write(block.Hot_block);
+            writer.write(block.Ongoing_user_program_count);
+            writer.write(block.Ongoing_user_read_count);
+            writer.write(block.Last_write_time);
+          }
+
+          // The pool order decides the next write frontier among the blocks
+          // of the same key, so it is stored as is.
+          writer.write<uint64_t>(plane.Free_block_pool.size());
+
+          for (auto& entry : plane.Free_block_pool) {
+            writer.write(entry.first);
+            writer.write(entry.second->BlockID);
+          }
+
+          __save_block_ids(writer, plane.Data_wf);
+          __save_block_ids(writer, plane.GC_wf);
+          __save_block_ids(writer, plane.Translation_wf);
+
+          auto history = plane.Block_usage_history;
+          writer.write<uint64_t>(history.size());
+
+          for (; !history.empty(); history.pop())
+            writer.write(history.front());
+        }
+}
+
+void
+Flash_Block_Manager_Base::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  reader.read_section("FBM");
+  reader.expect(total_concurrent_streams_no, "concurrent streams");
+
+  for (auto& channel : plane_manager)
+    for (auto& chip : channel)
+      for (auto& die : chip)
+        for (auto& plane : die) {
+          reader.expect(plane.Total_pages_count, "pages per plane");
+          plane.Free_pages_count = reader.read<uint32_t>();
+          plane.Valid_pages_count = reader.read<uint32_t>();
+          plane.Invalid_pages_count = reader.read<uint32_t>();
+
+          reader.expect<uint32_t>(plane.Blocks.size(), "blocks per plane");
+
+          for (auto& block : plane.Blocks) {
+            block.Current_page_write_index = reader.read<flash_page_ID_type>();
+            block.Current_status = reader.read<Block_Service_Status>();
+            block.Erase_count = reader.read<uint32_t>();
+            block.Invalid_page_count = reader.read<uint32_t>();
+            reader.read_vector(block.Invalid_page_bitmap);
+            block.Stream_id = reader.read<stream_id_type>();
+            block.Holds_mapping_data = reader.read<bool>();
+            block.Hot_block = reader.read<bool>();
+            block.Ongoing_user_program_count = reader.read<int>();
+            block.Ongoing_user_read_count = reader.read<int>();
+            block.Last_write_time = reader.read<sim_time_type>();
+          }
+
+          plane.Free_block_pool.clear();
+
+          for (uint64_t count = reader.read<uint64_t>(); 0 < count; --count) {
+            auto key = reader.read<uint32_t>();
+            auto& block = plane.Blocks.at(reader.read<flash_block_ID_type>());
+
+            plane.Free_block_pool.emplace(key, &block);
+          }
+
+          __load_block_ids(reader, plane, plane.Data_wf);
+          __load_block_ids(reader, plane, plane.GC_wf);
+          __load_block_ids(reader, plane, plane.Translation_wf);
+
+          plane.Block_usage_history = std::queue<flash_block_ID_type>();
+
+          for (uint64_t count = reader.read<uint64_t>(); 0 < count; --count)
+            plane.Block_usage_history.push(reader.read<flash_block_ID_type>());
+
+          plane.Victim_index.Rebuild(plane.Blocks);
+        }
+}
+
 FlashBlockManagerPtr
 SSD_Components::build_fbm_object(const DeviceParameterSet& params,
                                  uint32_t concurrent_stream_count,
@@ -1,10 +1,12 @@
 #ifndef BLOCK_POOL_MANAGER_BASE_H
 #define BLOCK_POOL_MANAGER_BASE_H
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
 #include "../../nvm_chip/flash_memory/Physical_Page_Address.h"
+#include "../../utils/Checkpoint.h"
 #include "../Stats.h"
 
 #include "BlockPoolSlotType.h"
@@ -14,6 +16,13 @@ namespace SSD_Components
 {
   class GC_and_WL_Unit_Base;
 
+  // Block pool state of the planes in a chip
+  struct ChipBlockPoolState {
+    uint32_t Free_blocks;
+    uint32_t Min_plane_free_blocks;
+    uint32_t Ongoing_erases;
+  };
+
   class Flash_Block_Manager_Base {
     friend class Address_Mapping_Unit_Page_Level;
     friend class GC_and_WL_Unit_Page_Level;
@@ -35,6 +44,7 @@ namespace SSD_Components
     uint32_t Get_min_max_erase_difference(const NVM::FlashMemory::Physical_Page_Address& plane_address);
     void Set_GC_and_WL_Unit(GC_and_WL_Unit_Base* );
     PlaneBookKeepingType& Get_plane_bookkeeping_entry(const NVM::FlashMemory::Physical_Page_Address& ppa);
+    ChipBlockPoolState Get_chip_block_pool_state(flash_channel_ID_type channel_id, flash_chip_ID_type chip_id) const;
     bool Block_has_ongoing_gc_wl(const NVM::FlashMemory::Physical_Page_Address& block_address);//Checks if there is an ongoing gc for block_address
     bool Can_execute_gc_wl(const NVM::FlashMemory::Physical_Page_Address& block_address);//Checks if the gc request can be executed on block_address (there shouldn't be any ongoing user read/program requests targeting block_address)
     void GC_WL_started(const NVM::FlashMemory::Physical_Page_Address& block_address);//Updates the block bookkeeping record
@@ -44,6 +54,11 @@ namespace SSD_Components
     void Program_transaction_serviced(const NVM::FlashMemory::Physical_Page_Address& page_address);//Updates the block bookkeeping record
     bool Is_having_ongoing_program(const NVM::FlashMemory::Physical_Page_Address& block_address);//Cheks if block has any ongoing program request
     bool Is_page_valid(const Block_Pool_Slot_Type& block, flash_page_ID_type page_id);//Make the page invalid in the block bookkeeping record
+
+    // Stores and restores the block bookkeeping of all planes. A checkpoint
+    // can only be taken while no GC/WL erase is in flight.
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
   protected:
     // Keeps track of plane block usage information
     // .... PlaneBookKeepingType ****plane_manager;
@@ -70,6 +85,26 @@ namespace SSD_Components
     return plane_manager[ppa.ChannelID][ppa.ChipID][ppa.DieID][ppa.PlaneID];
   }
 
+  force_inline ChipBlockPoolState
+  Flash_Block_Manager_Base::Get_chip_block_pool_state(flash_channel_ID_type channel_id,
+                                                      flash_chip_ID_type chip_id) const
+  {
+    ChipBlockPoolState state = { 0, UINT32_MAX, 0 };
+
+    for (auto& die : plane_manager[channel_id][chip_id]) {
+      for (auto& plane : die) {
+        uint32_t free_blocks = plane.Get_free_block_pool_size();
+
+        state.Free_blocks += free_blocks;
+        state.Min_plane_free_blocks = std::min(state.Min_plane_free_blocks,
+                                               free_blocks);
+        state.Ongoing_erases += uint32_t(plane.Ongoing_erase_operations.size());
+      }
+    }
+
+    return state;
+  }
+
   FlashBlockManagerPtr build_fbm_object(const DeviceParameterSet& params,
                                         uint32_t concurrent_stream_count,
                                         Stats& stats);
@@ -14,6 +14,7 @@
 #include <queue>
 
 #include "BlockPoolSlotType.h"
+#include "BlockVictimIndex.h"
 
 namespace SSD_Components {
   class PlaneBookKeepingType {
@@ -50,6 +51,9 @@ namespace SSD_Components {
     std::queue<flash_block_ID_type> Block_usage_history;
     std::set<flash_block_ID_type> Ongoing_erase_operations;
 
+    // GC/WL victim candidates ordered by invalid pages and erase counts
+    BlockVictimIndex Victim_index;
+
   public:
     PlaneBookKeepingType(uint32_t total_concurrent_streams_no,
                          uint32_t block_no_per_plane,
@@ -59,6 +63,7 @@ namespace SSD_Components {
     uint32_t Get_free_block_pool_size() const;
     void Check_bookkeeping_correctness(const NVM::FlashMemory::Physical_Page_Address& plane_address);
     void Add_to_free_block_pool(Block_Pool_Slot_Type& block, bool consider_dynamic_wl);
+    void Erase_block(Block_Pool_Slot_Type& block);
   };
 
   typedef std::vector<PlaneBookKeepingType>      PlaneBookKeepingOnDie;
@@ -79,7 +84,8 @@ namespace SSD_Components {
       Data_wf(total_concurrent_streams_no, nullptr),
       GC_wf(total_concurrent_streams_no, nullptr),
       Translation_wf(total_concurrent_streams_no, nullptr),
-      Ongoing_erase_operations()
+      Ongoing_erase_operations(),
+      Victim_index(block_no_per_plane, pages_no_per_block)
   {
     //Initialize block pool for plane
     Blocks.reserve(block_no_per_plane);
@@ -157,6 +163,14 @@ namespace SSD_Components {
     );
   }
 
+  force_inline void
+  PlaneBookKeepingType::Erase_block(Block_Pool_Slot_Type& block)
+  {
+    Victim_index.Erase_started(block);
+    block.Erase();
+    Victim_index.Erase_finished(block);
+  }
+
 }
 
 #endif /* Predefined include guard __MQSim__PlaneBookKeepingType__ */
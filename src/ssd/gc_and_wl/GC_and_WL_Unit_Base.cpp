@@ -30,6 +30,7 @@ GC_and_WL_Unit_Base::GC_and_WL_Unit_Base(const sim_object_id_type& id,
                                          uint32_t sector_no_per_page,
                                          bool use_copyback,
                                          double rho,
+                                         uint32_t gc_window_size,
                                          uint32_t max_ongoing_gc_reqs_per_plane,
                                          bool dynamic_wearleveling_enabled,
                                          bool static_wearleveling_enabled,
@@ -61,6 +62,8 @@ GC_and_WL_Unit_Base::GC_and_WL_Unit_Base(const sim_object_id_type& id,
     max_ongoing_gc_reqs_per_plane(max_ongoing_gc_reqs_per_plane),
     random_generator(seed),
     random_pp_threshold(uint32_t(rho * page_no_per_block)),
+    gc_window_size(gc_window_size != 0 ? gc_window_size
+                                       : uint32_t(std::log2(block_no_per_plane))),
 #if UNBLOCK_NOT_IN_USE
     channel_count(channel_count),
     chip_no_per_channel(chip_no_per_channel),
@@ -195,6 +198,11 @@ GC_and_WL_Unit_Base::__handle_transaction_service(NvmTransactionFlash* transacti
       break;
     case Transaction_Type::WRITE:
       block_manager->Program_transaction_serviced(transaction->Address);
+
+      if (transaction->Source == Transaction_Source_Type::MAPPING)
+        _stats.Total_mapping_page_programs++;
+      else
+        _stats.Total_host_page_programs++;
       break;
     default:
       PRINT_ERROR("Unexpected situation in the GC_and_WL_Unit_Base function!")
@@ -258,6 +266,8 @@ GC_and_WL_Unit_Base::__handle_transaction_service(NvmTransactionFlash* transacti
     break;
   }
   case Transaction_Type::WRITE:
+    _stats.Total_gc_wl_page_programs++;
+
     if (pbke.Blocks[((NvmTransactionFlashWR*)transaction)->RelatedErase->Address.BlockID].Holds_mapping_data)
     {
       address_mapping_unit->Remove_barrier_for_accessing_mvpn(transaction->Stream_id, (MVPN_type)transaction->LPA);
@@ -271,6 +281,9 @@ GC_and_WL_Unit_Base::__handle_transaction_service(NvmTransactionFlash* transacti
     pbke.Blocks[((NvmTransactionFlashWR*)transaction)->RelatedErase->Address.BlockID].Erase_transaction->Page_movement_activities.remove((NvmTransactionFlashWR*)transaction);
     break;
   case Transaction_Type::ERASE:
+    if (pbke.Blocks[transaction->Address.BlockID].Gc_start_time != INVALID_TIME)
+      _stats.Gc_latencies.emplace_back(Simulator->Time() - pbke.Blocks[transaction->Address.BlockID].Gc_start_time);
+
     pbke.Ongoing_erase_operations.erase(pbke.Ongoing_erase_operations.find(transaction->Address.BlockID));
     block_manager->Add_erased_block_to_pool(transaction->Address);
     block_manager->GC_WL_finished(transaction->Address);
@@ -344,6 +357,7 @@ SSD_Components::build_gc_and_wl_object(const DeviceParameterSet& params,
     params.Flash_Parameters.page_size_in_sector(),
     params.Use_Copyback_for_GC,
     rho,
+    params.GC_Window_Size,
     max_ongoing_gc_reqs_per_plane,
     params.gen_seed()
   );
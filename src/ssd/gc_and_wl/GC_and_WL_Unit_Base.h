@@ -89,6 +89,7 @@ namespace SSD_Components
     uint32_t rga_set_size;//The number of random flash blocks that are radnomly selected
     Utils::RandomGenerator random_generator;
     const uint32_t random_pp_threshold;
+    const uint32_t gc_window_size;//The number of least recently written blocks for WINDOWED_GREEDY
 
 #if UNBLOCK_NOT_IN_USE
     std::queue<Block_Pool_Slot_Type*> block_usage_fifo;
@@ -152,6 +153,7 @@ namespace SSD_Components
                         uint32_t sector_no_per_page,
                         bool use_copyback,
                         double rho,
+                        uint32_t gc_window_size,
                         uint32_t max_ongoing_gc_reqs_per_plane,
                         bool dynamic_wearleveling_enabled,
                         bool static_wearleveling_enabled,
@@ -168,7 +170,8 @@ namespace SSD_Components
     GC_Block_Selection_Policy_Type Get_gc_policy() const;
 
     // Returns the parameter specific to the GC block selection policy:
-    // threshold for random_pp, set_size for RGA
+    // threshold for random_pp, set_size for RGA, window size for
+    // windowed_greedy
     uint32_t Get_GC_policy_specific_parameter() const;
     uint32_t Get_minimum_number_of_free_pages_before_GC() const;
     bool Use_dynamic_wearleveling() const;
@@ -186,9 +189,10 @@ namespace SSD_Components
   GC_and_WL_Unit_Base::Get_GC_policy_specific_parameter() const
   {
     switch (block_selection_policy) {
-      case GC_Block_Selection_Policy_Type::RGA:       return rga_set_size;
-      case GC_Block_Selection_Policy_Type::RANDOM_PP: return random_pp_threshold;
-      default:                                        return 0;
+      case GC_Block_Selection_Policy_Type::RGA:             return rga_set_size;
+      case GC_Block_Selection_Policy_Type::RANDOM_PP:       return random_pp_threshold;
+      case GC_Block_Selection_Policy_Type::WINDOWED_GREEDY: return gc_window_size;
+      default:                                              return 0;
     }
   }
 
@@ -1,6 +1,7 @@
+#include <algorithm>
+#include <limits>
 #include <math.h>
 #include <vector>
-#include <set>
 #include "GC_and_WL_Unit_Page_Level.h"
 #include "../fbm/Flash_Block_Manager.h"
 #include "../FTL.h"
@@ -13,13 +14,83 @@ namespace SSD_Components
     Stats& stats, GC_Block_Selection_Policy_Type block_selection_policy, double gc_threshold, bool preemptible_gc_enabled, double gc_hard_threshold,
     uint32_t ChannelCount, uint32_t chip_no_per_channel, uint32_t die_no_per_chip, uint32_t plane_no_per_die,
     uint32_t block_no_per_plane, uint32_t Page_no_per_block, uint32_t sectors_per_page,
-    bool use_copyback, double rho, uint32_t max_ongoing_gc_reqs_per_plane, bool dynamic_wearleveling_enabled, bool static_wearleveling_enabled, uint32_t static_wearleveling_threshold, int seed)
+    bool use_copyback, double rho, uint32_t gc_window_size, uint32_t max_ongoing_gc_reqs_per_plane, bool dynamic_wearleveling_enabled, bool static_wearleveling_enabled, uint32_t static_wearleveling_threshold, int seed)
     : GC_and_WL_Unit_Base(id, address_mapping_unit, block_manager, tsu, flash_controller, stats, block_selection_policy, gc_threshold, preemptible_gc_enabled, gc_hard_threshold,
-    ChannelCount, chip_no_per_channel, die_no_per_chip, plane_no_per_die, block_no_per_plane, Page_no_per_block, sectors_per_page, use_copyback, rho, max_ongoing_gc_reqs_per_plane, 
+    ChannelCount, chip_no_per_channel, die_no_per_chip, plane_no_per_die, block_no_per_plane, Page_no_per_block, sectors_per_page, use_copyback, rho, gc_window_size, max_ongoing_gc_reqs_per_plane, 
       dynamic_wearleveling_enabled, static_wearleveling_enabled, static_wearleveling_threshold, seed)
   {
     rga_set_size = (uint32_t)log2(block_no_per_plane);
   }
+
+  // Returns the safe, fully written block with the highest score, the first
+  // visited one among equal scores.
+  template <typename Score>
+  force_inline flash_block_ID_type
+  GC_and_WL_Unit_Page_Level::__select_by_score(PlaneBookKeepingType& pbke, Score&& score)
+  {
+    const sim_time_type now = Simulator->Time();
+
+    flash_block_ID_type victim = BlockVictimIndex::NO_BLOCK;
+    double best_score = 0;
+
+    pbke.Victim_index.For_each_full_block([&](flash_block_ID_type block_id) {
+      auto& block = pbke.Blocks[block_id];
+
+      if (block.Invalid_page_count == 0 || !is_safe_gc_wl_candidate(pbke, block_id))
+        return;
+
+      // The utilization u is the ratio of the valid pages, and the age
+      // counts from 1 so that the blocks written at the same time are
+      // still ranked by u.
+      const double u = double(pages_no_per_block - block.Invalid_page_count) / pages_no_per_block;
+      const double age = double(now - block.Last_write_time + 1);
+      const double value = (u == 0) ? std::numeric_limits<double>::infinity()
+                                    : score(block, u, age);
+
+      if (victim == BlockVictimIndex::NO_BLOCK || best_score < value) {
+        victim = block_id;
+        best_score = value;
+      }
+    });
+
+    return victim;
+  }
+
+  flash_block_ID_type
+  GC_and_WL_Unit_Page_Level::__select_windowed_greedy(PlaneBookKeepingType& pbke)
+  {
+    __window.clear();
+
+    pbke.Victim_index.For_each_full_block([&](flash_block_ID_type block_id) {
+      if (is_safe_gc_wl_candidate(pbke, block_id))
+        __window.emplace_back(pbke.Blocks[block_id].Last_write_time, block_id);
+    });
+
+    if (gc_window_size < __window.size()) {
+      std::nth_element(__window.begin(), __window.begin() + gc_window_size, __window.end());
+      __window.resize(gc_window_size);
+    }
+
+    flash_block_ID_type victim = BlockVictimIndex::NO_BLOCK;
+    std::pair<sim_time_type, flash_block_ID_type> victim_key;
+
+    for (auto& key : __window) {
+      auto& block = pbke.Blocks[key.second];
+
+      if (block.Invalid_page_count == 0)
+        continue;
+
+      // More invalid pages first, then the older one
+      if (victim == BlockVictimIndex::NO_BLOCK
+          || pbke.Blocks[victim].Invalid_page_count < block.Invalid_page_count
+          || (pbke.Blocks[victim].Invalid_page_count == block.Invalid_page_count && key < victim_key)) {
+        victim = key.second;
+        victim_key = key;
+      }
+    }
+
+    return victim;
+  }
   
   bool GC_and_WL_Unit_Page_Level::GC_is_in_urgent_mode(const NVM::FlashMemory::Flash_Chip* chip) const
   {
@@ -55,24 +126,34 @@ namespace SSD_Components
         gc_candidate_block_id = 0;
         if (pbke.Ongoing_erase_operations.find(0) != pbke.Ongoing_erase_operations.end())
           gc_candidate_block_id++;
-        for (flash_block_ID_type block_id = 1; block_id < block_no_per_plane; block_id++)
-        {
-          if (pbke.Blocks[block_id].Invalid_page_count > pbke.Blocks[gc_candidate_block_id].Invalid_page_count
-            && pbke.Blocks[block_id].Current_page_write_index == pages_no_per_block
-            && is_safe_gc_wl_candidate(pbke, block_id))
-            gc_candidate_block_id = block_id;
-        }
+
+        // The victim index keeps the fully written blocks ordered by their
+        // invalid page count, and the first safe one replaces the default
+        // candidate only if it has more invalid pages.
+        flash_block_ID_type most_invalidated = pbke.Victim_index.Most_invalidated(
+          [&](flash_block_ID_type block_id) { return is_safe_gc_wl_candidate(pbke, block_id); });
+
+        if (most_invalidated != BlockVictimIndex::NO_BLOCK
+            && pbke.Blocks[most_invalidated].Invalid_page_count > pbke.Blocks[gc_candidate_block_id].Invalid_page_count)
+          gc_candidate_block_id = most_invalidated;
         break;
       }
       case SSD_Components::GC_Block_Selection_Policy_Type::RGA:
       {
-        std::set<flash_block_ID_type> random_set;
+        // The set is only a few (log2 of the blocks per plane) entries, so a
+        // sorted vector replaces the std::set with the same iteration order.
+        std::vector<flash_block_ID_type> random_set;
+        random_set.reserve(rga_set_size);
         while (random_set.size() < rga_set_size)
         {
           flash_block_ID_type block_id = random_generator.Uniform_uint(0, block_no_per_plane - 1);
           if (pbke.Ongoing_erase_operations.find(block_id) == pbke.Ongoing_erase_operations.end()
             && is_safe_gc_wl_candidate(pbke, block_id))
-            random_set.insert(block_id);
+          {
+            auto pos = std::lower_bound(random_set.begin(), random_set.end(), block_id);
+            if (pos == random_set.end() || *pos != block_id)
+              random_set.insert(pos, block_id);
+          }
         }
         gc_candidate_block_id = *random_set.begin();
         for(auto &block_id : random_set)
@@ -117,6 +198,25 @@ namespace SSD_Components
         gc_candidate_block_id = pbke.Block_usage_history.front();
         pbke.Block_usage_history.pop();
         break;
+      case SSD_Components::GC_Block_Selection_Policy_Type::COST_BENEFIT:
+        gc_candidate_block_id = __select_by_score(pbke, [](const Block_Pool_Slot_Type&, double u, double age) {
+          return (1 - u) * age / (2 * u);
+        });
+        if (gc_candidate_block_id == BlockVictimIndex::NO_BLOCK)
+          return;
+        break;
+      case SSD_Components::GC_Block_Selection_Policy_Type::COST_AGE_TIMES:
+        gc_candidate_block_id = __select_by_score(pbke, [](const Block_Pool_Slot_Type& block, double u, double age) {
+          return (1 - u) * age / (u * (block.Erase_count + 1));
+        });
+        if (gc_candidate_block_id == BlockVictimIndex::NO_BLOCK)
+          return;
+        break;
+      case SSD_Components::GC_Block_Selection_Policy_Type::WINDOWED_GREEDY:
+        gc_candidate_block_id = __select_windowed_greedy(pbke);
+        if (gc_candidate_block_id == BlockVictimIndex::NO_BLOCK)
+          return;
+        break;
       default:
         break;
       }
@@ -134,6 +234,7 @@ namespace SSD_Components
       //Run the state machine to protect against race condition
       block_manager->GC_WL_started(gc_candidate_address);
       pbke.Ongoing_erase_operations.insert(gc_candidate_block_id);
+      block.Gc_start_time = Simulator->Time();
 
       address_mapping_unit->Set_barrier_for_accessing_physical_block(gc_candidate_address);//Lock the block, so no user request can intervene while the GC is progressing
 
@@ -5,6 +5,8 @@
 #include "../phy/NVM_PHY_ONFI.h"
 #include "../../utils/RandomGenerator.h"
 #include <queue>
+#include <utility>
+#include <vector>
 
 
 namespace SSD_Components
@@ -17,7 +19,7 @@ namespace SSD_Components
       Stats& stats, GC_Block_Selection_Policy_Type block_selection_policy, double gc_threshold, bool preemptible_gc_enabled, double gc_hard_threshold,
       uint32_t channel_count, uint32_t chip_no_per_channel, uint32_t die_no_per_chip, uint32_t plane_no_per_die,
       uint32_t block_no_per_plane, uint32_t page_no_per_block, uint32_t sectors_per_page,
-      bool use_copyback, double rho, uint32_t max_ongoing_gc_reqs_per_plane = 10,
+      bool use_copyback, double rho, uint32_t gc_window_size, uint32_t max_ongoing_gc_reqs_per_plane = 10,
       bool dynamic_wearleveling_enabled = true, bool static_wearleveling_enabled = true, uint32_t static_wearleveling_threshold = 100, int seed = 432);
 
     /*This function is used for implementing preemptible GC execution. If for a flash chip the free block
@@ -26,6 +28,14 @@ namespace SSD_Components
     bool GC_is_in_urgent_mode(const NVM::FlashMemory::Flash_Chip*) const final;
 
     void Check_gc_required(const uint32_t free_block_pool_size, const NVM::FlashMemory::Physical_Page_Address& plane_address);
+
+  private:
+    // Least recently written blocks examined by WINDOWED_GREEDY
+    std::vector<std::pair<sim_time_type, flash_block_ID_type>> __window;
+
+    template <typename Score>
+    flash_block_ID_type __select_by_score(PlaneBookKeepingType& pbke, Score&& score);
+    flash_block_ID_type __select_windowed_greedy(PlaneBookKeepingType& pbke);
   };
 }
 #endif // !GC_AND_WL_UNIT_PAGE_LEVEL_H
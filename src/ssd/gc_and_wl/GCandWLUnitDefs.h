@@ -38,7 +38,31 @@ namespace SSD_Components {
      * The FIFO algortihm described in P. Desnoyers, "Analytic Modeling of SSD
      * Write Performance, SYSTOR, 2012".
      */
-    FIFO
+    FIFO,
+
+    /*
+     * The cost-benefit policy of the log-structured file system described in:
+     * "M. Rosenblum and J. K. Ousterhout, The Design and Implementation of a
+     * Log-Structured File System, ACM TOCS, 1992". The victim maximizes
+     * (1 - u) * age / 2u, where u is the valid page ratio of the block.
+     */
+    COST_BENEFIT,
+
+    /*
+     * The cost-age-times policy described in: "M.-L. Chiang et al., Using
+     * Data Clustering to Improve Cleaning Performance for Flash Memory,
+     * Software: Practice and Experience, 1999". The cost-benefit score is
+     * divided by the erase count of the block to spread the wear.
+     */
+    COST_AGE_TIMES,
+
+    /*
+     * The windowed greedy policy described in: "X.-Y. Hu et al., Write
+     * Amplification Analysis in Flash-Based Solid State Drives, SYSTOR,
+     * 2009". The greedy choice is made among the d least recently written
+     * blocks of the plane.
+     */
+    WINDOWED_GREEDY
   };
 }
 
@@ -54,6 +78,9 @@ to_string(SSD_Components::GC_Block_Selection_Policy_Type policy)
   case ENUM_TO_STR(GC_Block_Selection_Policy_Type, RANDOM_P);
   case ENUM_TO_STR(GC_Block_Selection_Policy_Type, RANDOM_PP);
   case ENUM_TO_STR(GC_Block_Selection_Policy_Type, FIFO);
+  case ENUM_TO_STR(GC_Block_Selection_Policy_Type, COST_BENEFIT);
+  case ENUM_TO_STR(GC_Block_Selection_Policy_Type, COST_AGE_TIMES);
+  case ENUM_TO_STR(GC_Block_Selection_Policy_Type, WINDOWED_GREEDY);
   }
 }
 
@@ -70,6 +97,9 @@ to_gc_block_selection_policy(std::string v)
   STR_TO_ENUM(GC_Block_Selection_Policy_Type, RANDOM_P);
   STR_TO_ENUM(GC_Block_Selection_Policy_Type, RANDOM_PP);
   STR_TO_ENUM(GC_Block_Selection_Policy_Type, FIFO);
+  STR_TO_ENUM(GC_Block_Selection_Policy_Type, COST_BENEFIT);
+  STR_TO_ENUM(GC_Block_Selection_Policy_Type, COST_AGE_TIMES);
+  STR_TO_ENUM(GC_Block_Selection_Policy_Type, WINDOWED_GREEDY);
 
   throw mqsim_error("Unknown GC block selection policy specified in the SSD "
                     "configuration file");
@@ -85,7 +85,9 @@ SSD_Components::build_amu_object(const DeviceParameterSet& params,
       params.Flash_Parameters.page_size_in_sector(),
       params.Flash_Parameters.Page_Capacity,
       params.Overprovisioning_Ratio,
-      params.CMT_Sharing_Mode
+      params.CMT_Sharing_Mode,
+      true,
+      params.GMT_Backing_Directory
     );
 
   case SSD_Components::Flash_Address_Mapping_Type::HYBRID:
@@ -15,6 +15,7 @@
 #include "../NvmTransactionFlashWR.h"
 
 #include "AddressMappingUnitDefs.h"
+#include "../../utils/Checkpoint.h"
 #include "../../utils/Logical_Address_Partitioning_Unit.h"
 
 namespace SSD_Components
@@ -79,12 +80,20 @@ namespace SSD_Components
     // mapping table entries on the flash space
     virtual void Store_mapping_table_on_flash_at_start() = 0;
 
+    // Stores and restores the mapping state of a preconditioned device
+    virtual void Save_checkpoint(Utils::CheckpointWriter& writer) const = 0;
+    virtual void Load_checkpoint(Utils::CheckpointReader& reader) = 0;
+
     // Returns the maximum number of entries that could be stored in
     // the cached mapping table
     virtual uint32_t Get_cmt_capacity() = 0;
 
     virtual uint32_t Get_current_cmt_occupancy_for_stream(stream_id_type stream_id) = 0;
 
+    // Returns the number of entries currently stored in the cached mapping
+    // tables of all streams
+    virtual uint32_t Get_current_cmt_occupancy() = 0;
+
     //Returns the number of logical pages allocated to an I/O stream
     virtual LPA_type Get_logical_pages_count(stream_id_type stream_id) = 0;
 
@@ -20,6 +20,7 @@ namespace SSD_Components
   int Address_Mapping_Unit_Hybrid::Bring_to_CMT_for_preconditioning(stream_id_type stream_id, LPA_type lpa) { return 0; }
   uint32_t Address_Mapping_Unit_Hybrid::Get_cmt_capacity() { return 0; }
   uint32_t Address_Mapping_Unit_Hybrid::Get_current_cmt_occupancy_for_stream(stream_id_type stream_id) { return 0; }
+  uint32_t Address_Mapping_Unit_Hybrid::Get_current_cmt_occupancy() { return 0; }
   void Address_Mapping_Unit_Hybrid::Translate_lpa_to_ppa_and_dispatch(const std::list<NvmTransaction*>& transaction_list) {}
   void Address_Mapping_Unit_Hybrid::Get_data_mapping_info_for_gc(const stream_id_type stream_id, const LPA_type lpa, PPA_type& ppa, page_status_type& page_state) {}
   void Address_Mapping_Unit_Hybrid::Get_translation_mapping_info_for_gc(const stream_id_type stream_id, const MVPN_type mvpn, MPPN_type& mppa, sim_time_type& timestamp) {}
@@ -41,6 +42,14 @@ namespace SSD_Components
   void Address_Mapping_Unit_Hybrid::Convert_ppa_to_address(const PPA_type ppa, NVM::FlashMemory::Physical_Page_Address& address) {}
   PPA_type Address_Mapping_Unit_Hybrid::Convert_address_to_ppa(const NVM::FlashMemory::Physical_Page_Address& pageAddress) { return 0; }
   void Address_Mapping_Unit_Hybrid::Store_mapping_table_on_flash_at_start() {}
+  void Address_Mapping_Unit_Hybrid::Save_checkpoint(Utils::CheckpointWriter& writer) const
+  {
+    throw mqsim_error("Checkpoints are not supported by the hybrid address mapping");
+  }
+  void Address_Mapping_Unit_Hybrid::Load_checkpoint(Utils::CheckpointReader& reader)
+  {
+    throw mqsim_error("Checkpoints are not supported by the hybrid address mapping");
+  }
   void Address_Mapping_Unit_Hybrid::Allocate_new_page_for_gc(NvmTransactionFlashWR* transaction, bool is_translation_page) {}
   void Address_Mapping_Unit_Hybrid::Set_barrier_for_accessing_physical_block(const NVM::FlashMemory::Physical_Page_Address& block_address) {}
   void Address_Mapping_Unit_Hybrid::Set_barrier_for_accessing_lpa(stream_id_type stream_id, LPA_type lpa) {}
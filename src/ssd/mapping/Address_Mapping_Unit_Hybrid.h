@@ -23,12 +23,15 @@ namespace SSD_Components
     int Bring_to_CMT_for_preconditioning(stream_id_type stream_id, LPA_type lpa);
     uint32_t Get_cmt_capacity();
     uint32_t Get_current_cmt_occupancy_for_stream(stream_id_type stream_id);
+    uint32_t Get_current_cmt_occupancy();
     void Translate_lpa_to_ppa_and_dispatch(const std::list<NvmTransaction*>& transactionList);
     void Get_data_mapping_info_for_gc(const stream_id_type stream_id, const LPA_type lpa, PPA_type& ppa, page_status_type& page_state);
     void Get_translation_mapping_info_for_gc(const stream_id_type stream_id, const MVPN_type mvpn, MPPN_type& mppa, sim_time_type& timestamp);
     void Allocate_new_page_for_gc(NvmTransactionFlashWR* transaction, bool is_translation_page);
 
     void Store_mapping_table_on_flash_at_start();
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
     LPA_type Get_logical_pages_count(stream_id_type stream_id);
     NVM::FlashMemory::Physical_Page_Address Convert_ppa_to_address(const PPA_type ppa);
     void Convert_ppa_to_address(const PPA_type ppn, NVM::FlashMemory::Physical_Page_Address& address);
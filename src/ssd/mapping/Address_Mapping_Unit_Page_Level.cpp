@@ -11,46 +11,106 @@
 
 using namespace SSD_Components;
 
-force_inline
-GMTEntryType::GMTEntryType()
-  : PPA(NO_PPA),
-    WrittenStateBitmap(UNWRITTEN_LOGICAL_PAGE),
-    TimeStamp(0)
-{}
-
 force_inline
 GTDEntryType::GTDEntryType()
   : MPPN(NO_MPPN),
     TimeStamp(INVALID_TIME_STAMP)
 { }
 
+constexpr uint32_t Cached_Mapping_Table::NO_SLOT;
+
 Cached_Mapping_Table::Cached_Mapping_Table(uint32_t capacity)
-  : capacity(capacity)
-{ }
+  : bucketMask(0),
+    hashShift(0),
+    freeSlots(NO_SLOT),
+    lruHead(NO_SLOT),
+    lruTail(NO_SLOT),
+    size(0),
+    capacity(capacity)
+{
+  // Keep the load factor of the hash index under 0.5.
+  uint32_t bits = 1;
+  while ((1ULL << bits) < uint64_t(capacity) * 2)
+    ++bits;
 
-Cached_Mapping_Table::~Cached_Mapping_Table()
+  buckets.assign(1ULL << bits, Bucket{0, NO_SLOT});
+  bucketMask = buckets.size() - 1;
+  hashShift = 64 - bits;
+}
+
+force_inline uint64_t Cached_Mapping_Table::home_bucket(const LPA_type key) const
 {
-  // std::unordered_map<LPA_type, CMTSlotType*> addressMap;
-  // std::list<std::pair<LPA_type, CMTSlotType*>> lruList;
+  // Fibonacci hashing spreads the consecutive LPAs over the whole index.
+  return (uint64_t(key) * 0x9E3779B97F4A7C15ULL) >> hashShift;
+}
 
-  auto entry = addressMap.begin();
-  while (entry != addressMap.end())
+force_inline uint64_t Cached_Mapping_Table::find_bucket(const LPA_type key) const
+{
+  uint64_t pos = home_bucket(key);
+  while (buckets[pos].slot != NO_SLOT)
   {
-    delete (*entry).second;
-    addressMap.erase(entry++);
+    if (buckets[pos].key == key)
+      return pos;
+    pos = (pos + 1) & bucketMask;
   }
+  return buckets.size();
+}
+
+force_inline CMTSlotType* Cached_Mapping_Table::find_slot(const LPA_type key)
+{
+  uint64_t pos = find_bucket(key);
+  if (pos == buckets.size())
+    return nullptr;
+  return &slots[buckets[pos].slot];
 }
 
-inline bool Cached_Mapping_Table::Exists(const stream_id_type streamID, const LPA_type lpa)
+force_inline void Cached_Mapping_Table::erase_bucket(uint64_t pos)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-  auto it = addressMap.find(key);
-  if (it == addressMap.end())
+  // Backward shift deletion: move the following entries of the probe
+  // sequence into the hole, so no tombstone is left in the index.
+  buckets[pos].slot = NO_SLOT;
+  uint64_t next = (pos + 1) & bucketMask;
+  while (buckets[next].slot != NO_SLOT)
+  {
+    uint64_t home = home_bucket(buckets[next].key);
+    if (((next - home) & bucketMask) >= ((next - pos) & bucketMask))
+    {
+      buckets[pos] = buckets[next];
+      buckets[next].slot = NO_SLOT;
+      pos = next;
+    }
+    next = (next + 1) & bucketMask;
+  }
+}
+
+force_inline void Cached_Mapping_Table::lru_unlink(const uint32_t slot)
+{
+  CMTSlotType& item = slots[slot];
+  if (item.Prev == NO_SLOT) lruHead = item.Next;
+  else slots[item.Prev].Next = item.Next;
+  if (item.Next == NO_SLOT) lruTail = item.Prev;
+  else slots[item.Next].Prev = item.Prev;
+}
+
+force_inline void Cached_Mapping_Table::lru_push_front(const uint32_t slot)
+{
+  CMTSlotType& item = slots[slot];
+  item.Prev = NO_SLOT;
+  item.Next = lruHead;
+  if (lruHead == NO_SLOT) lruTail = slot;
+  else slots[lruHead].Prev = slot;
+  lruHead = slot;
+}
+
+bool Cached_Mapping_Table::Exists(const stream_id_type streamID, const LPA_type lpa)
+{
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpa));
+  if (slot == nullptr)
   {
     PRINT_DEBUG("Address mapping table query - Stream ID:" << streamID << ", LPA:" << lpa << ", MISS")
       return false;
   }
-  if (it->second->Status != CMTEntryStatus::VALID)
+  if (slot->Status != CMTEntryStatus::VALID)
   {
     PRINT_DEBUG("Address mapping table query - Stream ID:" << streamID << ", LPA:" << lpa << ", MISS")
     return false;
@@ -60,104 +120,157 @@ inline bool Cached_Mapping_Table::Exists(const stream_id_type streamID, const LP
 }
 PPA_type Cached_Mapping_Table::Retrieve_ppa(const stream_id_type streamID, const LPA_type lpn)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-  auto it = addressMap.find(key);
-  assert(it != addressMap.end());
-  assert(it->second->Status == CMTEntryStatus::VALID);
+  uint64_t pos = find_bucket(LPN_TO_UNIQUE_KEY(streamID, lpn));
+  assert(pos != buckets.size());
+  uint32_t slot = buckets[pos].slot;
+  assert(slots[slot].Status == CMTEntryStatus::VALID);
 
-  lruList.splice(lruList.begin(), lruList, it->second->listPtr);
-  return it->second->PPA;
+  lru_unlink(slot);
+  lru_push_front(slot);
+  return slots[slot].PPA;
 }
 page_status_type Cached_Mapping_Table::Get_bitmap_vector_of_written_sectors(const stream_id_type streamID, const LPA_type lpn)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-  auto it = addressMap.find(key);
-  assert(it != addressMap.end());
-  assert(it->second->Status == CMTEntryStatus::VALID);
-  return it->second->WrittenStateBitmap;
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpn));
+  assert(slot != nullptr);
+  assert(slot->Status == CMTEntryStatus::VALID);
+  return slot->WrittenStateBitmap;
 }
 void Cached_Mapping_Table::Update_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const page_status_type pageWriteState)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-  auto it = addressMap.find(key);
-  assert(it != addressMap.end());
-  assert(it->second->Status == CMTEntryStatus::VALID);
-  it->second->PPA = ppa;
-  it->second->WrittenStateBitmap = pageWriteState;
-  it->second->Dirty = true;
-  it->second->Stream_id = streamID;
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpa));
+  assert(slot != nullptr);
+  assert(slot->Status == CMTEntryStatus::VALID);
+  slot->PPA = ppa;
+  slot->WrittenStateBitmap = pageWriteState;
+  slot->Dirty = true;
+  slot->Stream_id = streamID;
   PRINT_DEBUG("Address mapping table update entry - Stream ID:" << streamID << ", LPA:" << lpa << ", PPA:" << ppa)
 }
 void Cached_Mapping_Table::Insert_new_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const unsigned long long pageWriteState)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-  auto it = addressMap.find(key);
-  if (it == addressMap.end())
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpa));
+  if (slot == nullptr)
     throw std::logic_error("No slot is reserved!");
 
-  it->second->Status = CMTEntryStatus::VALID;
-  it->second->PPA = ppa;
-  it->second->WrittenStateBitmap = pageWriteState;
-  it->second->Dirty = false;
-  it->second->Stream_id = streamID;
+  slot->Status = CMTEntryStatus::VALID;
+  slot->PPA = ppa;
+  slot->WrittenStateBitmap = pageWriteState;
+  slot->Dirty = false;
+  slot->Stream_id = streamID;
   PRINT_DEBUG("Address mapping table insert entry - Stream ID:" << streamID << ", LPA:" << lpa << ", PPA:" << ppa)
 }
 bool Cached_Mapping_Table::Is_slot_reserved_for_lpn_and_waiting(const stream_id_type streamID, const LPA_type lpn)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-  auto it = addressMap.find(key);
-  if (it != addressMap.end())
-    if (it->second->Status == CMTEntryStatus::WAITING)
-      return true;
-  return false;
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpn));
+  return slot != nullptr && slot->Status == CMTEntryStatus::WAITING;
 }
-inline bool Cached_Mapping_Table::Check_free_slot_availability()
+bool Cached_Mapping_Table::Check_free_slot_availability()
 {
-  return addressMap.size() < capacity;
+  return size < capacity;
+}
+uint32_t Cached_Mapping_Table::Size() const
+{
+  return size;
 }
 void Cached_Mapping_Table::Reserve_slot_for_lpn(const stream_id_type streamID, const LPA_type lpn)
 {
   LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-  if (addressMap.find(key) != addressMap.end())
-    throw std::logic_error("Duplicate lpa insertion into CMT!");
-  if (addressMap.size() >= capacity)
+  uint64_t pos = home_bucket(key);
+  while (buckets[pos].slot != NO_SLOT)
+  {
+    if (buckets[pos].key == key)
+      throw std::logic_error("Duplicate lpa insertion into CMT!");
+    pos = (pos + 1) & bucketMask;
+  }
+  if (size >= capacity)
     throw std::logic_error("CMT overfull!");
 
-  auto* cmtEnt = new CMTSlotType();
-  cmtEnt->Dirty = false;
-  cmtEnt->Stream_id = streamID;
-  lruList.push_front(std::pair<LPA_type, CMTSlotType*>(key, cmtEnt));
-  cmtEnt->Status = CMTEntryStatus::WAITING;
-  cmtEnt->listPtr = lruList.begin();
-  addressMap[key] = cmtEnt;
+  uint32_t slot = freeSlots;
+  if (slot == NO_SLOT)
+  {
+    slot = uint32_t(slots.size());
+    slots.emplace_back();
+  }
+  else freeSlots = slots[slot].Next;
+
+  CMTSlotType& cmtEnt = slots[slot];
+  cmtEnt.Dirty = false;
+  cmtEnt.Stream_id = streamID;
+  cmtEnt.Status = CMTEntryStatus::WAITING;
+  cmtEnt.Key = key;
+  lru_push_front(slot);
+
+  buckets[pos].key = key;
+  buckets[pos].slot = slot;
+  ++size;
 }
 CMTSlotType Cached_Mapping_Table::Evict_one_slot(LPA_type& lpa)
 {
-  assert(addressMap.size() > 0);
-  addressMap.erase(lruList.back().first);
-  lpa = UNIQUE_KEY_TO_LPN(lruList.back().second->Stream_id,lruList.back().first);
-  CMTSlotType evictedItem = *lruList.back().second;
-  delete lruList.back().second;
-  lruList.pop_back();
+  assert(size > 0);
+  uint32_t slot = lruTail;
+  CMTSlotType evictedItem = slots[slot];
+
+  erase_bucket(find_bucket(evictedItem.Key));
+  lru_unlink(slot);
+  lpa = UNIQUE_KEY_TO_LPN(evictedItem.Stream_id, evictedItem.Key);
+
+  slots[slot].Next = freeSlots;
+  freeSlots = slot;
+  --size;
   return evictedItem;
 }
 bool Cached_Mapping_Table::Is_dirty(const stream_id_type streamID, const LPA_type lpa)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpa);
-  auto it = addressMap.find(key);
-  if (it == addressMap.end())
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpa));
+  if (slot == nullptr)
     throw std::logic_error("The requested slot does not exist!");
 
-  return it->second->Dirty;
+  return slot->Dirty;
 }
 void Cached_Mapping_Table::Make_clean(const stream_id_type streamID, const LPA_type lpn)
 {
-  LPA_type key = LPN_TO_UNIQUE_KEY(streamID, lpn);
-  auto it = addressMap.find(key);
-  if (it == addressMap.end())
+  CMTSlotType* slot = find_slot(LPN_TO_UNIQUE_KEY(streamID, lpn));
+  if (slot == nullptr)
     throw std::logic_error("The requested slot does not exist!");
 
-  it->second->Dirty = false;
+  slot->Dirty = false;
+}
+void Cached_Mapping_Table::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  writer.write(capacity);
+  writer.write(size);
+
+  for (uint32_t slot = lruTail; slot != NO_SLOT; slot = slots[slot].Prev)
+  {
+    const CMTSlotType& item = slots[slot];
+    writer.write(item.Stream_id);
+    writer.write(item.Key);
+    writer.write(item.PPA);
+    writer.write(item.WrittenStateBitmap);
+    writer.write(item.Dirty);
+    writer.write(item.Status);
+  }
+}
+void Cached_Mapping_Table::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  reader.expect(capacity, "cached mapping table capacity");
+
+  if (size != 0)
+    throw mqsim_error("Restoring a checkpoint into a non-empty CMT");
+
+  for (uint32_t count = reader.read<uint32_t>(); count > 0; --count)
+  {
+    auto stream_id = reader.read<stream_id_type>();
+    auto key = reader.read<LPA_type>();
+    Reserve_slot_for_lpn(stream_id, UNIQUE_KEY_TO_LPN(stream_id, key));
+
+    CMTSlotType* slot = find_slot(key);
+    slot->PPA = reader.read<PPA_type>();
+    slot->WrittenStateBitmap = reader.read<unsigned long long>();
+    slot->Dirty = reader.read<bool>();
+    slot->Status = reader.read<CMTEntryStatus>();
+  }
 }
 
 
@@ -172,14 +285,17 @@ AddressMappingDomain::AddressMappingDomain(uint32_t cmt_capacity,
                                            const PlaneIDs& plane_ids,
                                            PPA_type total_physical_sectors_no,
                                            LHA_type total_logical_sectors_no,
-                                           uint32_t sectors_no_per_page)
+                                           uint32_t sectors_no_per_page,
+                                           PPA_type device_physical_pages_no,
+                                           const std::string& gmt_backing_dir)
   : max_logical_sector_address(total_logical_sectors_no),
     Translation_entries_per_page(no_of_translation_entries_per_page),
     Total_logical_pages_no((max_logical_sector_address / sectors_no_per_page) + (max_logical_sector_address % sectors_no_per_page == 0? 0 : 1)),
     Total_physical_pages_no(total_physical_sectors_no / sectors_no_per_page),
     Total_translation_pages_no(MVPN_type(Total_logical_pages_no / Translation_entries_per_page)),
     GlobalTranslationDirectory(Total_translation_pages_no + 1),
-    GlobalMappingTable(Total_logical_pages_no),
+    GlobalMappingTable(Total_logical_pages_no, device_physical_pages_no,
+                       sectors_no_per_page, gmt_backing_dir),
     CMT_entry_size(cmt_entry_size),
     No_of_inserted_entries_in_preconditioning(0),
     Channel_ids(channel_ids.begin(), channel_ids.end()),
@@ -220,13 +336,39 @@ AddressMappingDomain::~AddressMappingDomain()
   }
 }
 
+void AddressMappingDomain::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  writer.write(Total_logical_pages_no);
+  writer.write(Total_physical_pages_no);
+  writer.write_vector(GlobalTranslationDirectory);
+  GlobalMappingTable.Save_checkpoint(writer);
+  CMT->Save_checkpoint(writer);
+  writer.write(No_of_inserted_entries_in_preconditioning);
+}
+
+void AddressMappingDomain::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  reader.expect(Total_logical_pages_no, "logical pages of the address mapping domain");
+  reader.expect(Total_physical_pages_no, "physical pages of the address mapping domain");
+
+  std::vector<GTDEntryType> gtd;
+  reader.read_vector(gtd);
+  if (gtd.size() != GlobalTranslationDirectory.size())
+    throw mqsim_error("Corrupted global translation directory in the checkpoint");
+  GlobalTranslationDirectory.swap(gtd);
+
+  GlobalMappingTable.Load_checkpoint(reader);
+  CMT->Load_checkpoint(reader);
+  No_of_inserted_entries_in_preconditioning = reader.read<uint32_t>();
+}
+
 inline void AddressMappingDomain::Update_mapping_info(const bool ideal_mapping, const stream_id_type stream_id, const LPA_type lpa, const PPA_type ppa, const page_status_type page_status_bitmap)
 {
   if (ideal_mapping)
   {
-    GlobalMappingTable[lpa].PPA = ppa;
-    GlobalMappingTable[lpa].WrittenStateBitmap = page_status_bitmap;
-    GlobalMappingTable[lpa].TimeStamp = CurrentTimeStamp;
+    GlobalMappingTable.Set_ppa(lpa, ppa);
+    GlobalMappingTable.Set_bitmap(lpa, page_status_bitmap);
+    GlobalMappingTable.Set_timestamp(lpa, CurrentTimeStamp);
   }
   else
     CMT->Update_mapping_info(stream_id, lpa, ppa, page_status_bitmap);
@@ -235,20 +377,20 @@ inline void AddressMappingDomain::Update_mapping_info(const bool ideal_mapping,
 inline page_status_type AddressMappingDomain::Get_page_status(const bool ideal_mapping, const stream_id_type stream_id, const LPA_type lpa)
 {
   if (ideal_mapping)
-    return GlobalMappingTable[lpa].WrittenStateBitmap;
+    return GlobalMappingTable.Get_bitmap(lpa);
   else
     return CMT->Get_bitmap_vector_of_written_sectors(stream_id, lpa);
 }
 inline PPA_type AddressMappingDomain::Get_ppa(const bool ideal_mapping, const stream_id_type stream_id, const LPA_type lpa)
 {
   if (ideal_mapping)
-    return GlobalMappingTable[lpa].PPA;
+    return GlobalMappingTable.Get_ppa(lpa);
   else
     return CMT->Retrieve_ppa(stream_id, lpa);
 }
 inline PPA_type AddressMappingDomain::Get_ppa_for_preconditioning(const stream_id_type /* stream_id */, const LPA_type lpa)
 {
-  return GlobalMappingTable[lpa].PPA;
+  return GlobalMappingTable.Get_ppa(lpa);
 }
 inline bool AddressMappingDomain::Mapping_entry_accessible(const bool ideal_mapping, const stream_id_type stream_id, const LPA_type lpa)
 {
@@ -285,7 +427,8 @@ Address_Mapping_Unit_Page_Level::Address_Mapping_Unit_Page_Level(const sim_objec
                                                                  uint32_t PageSizeInByte,
                                                                  double Overprovisioning_ratio,
                                                                  CMT_Sharing_Mode sharing_mode,
-                                                                 bool fold_large_addresses)
+                                                                 bool fold_large_addresses,
+                                                                 const std::string& gmt_backing_dir)
   : Address_Mapping_Unit_Base(id,
                               ftl,
                               flash_controller,
@@ -332,8 +475,6 @@ Address_Mapping_Unit_Page_Level::Address_Mapping_Unit_Page_Level(const sim_objec
   cmt_capacity = cmt_capacity_in_byte / CMT_entry_size;
 
   // domains = new AddressMappingDomain*[no_of_input_streams];
-  domains.reserve(no_of_input_streams);
-
   for (uint32_t domainID = 0; domainID < no_of_input_streams; domainID++)
   {
     Cached_Mapping_Table* sharedCMT = nullptr;
@@ -382,7 +523,9 @@ Address_Mapping_Unit_Page_Level::Address_Mapping_Unit_Page_Level(const sim_objec
                            domainID),
                          __logical_addr_partition_unit.allocated_lha_count_from_device(
                            domainID),
-                         sector_no_per_page);
+                         sector_no_per_page,
+                         total_physical_pages_no,
+                         gmt_backing_dir);
   }
 }
 
@@ -435,7 +578,7 @@ Address_Mapping_Unit_Page_Level::allocate_page_in_plane_for_user_write(NvmTransa
 
         auto* read_tr = _make_update_read_tr(transaction,
                                              read_pages_bitmap,
-                                             domain.GlobalMappingTable[transaction->LPA].TimeStamp,
+                                             domain.GlobalMappingTable.Get_timestamp(transaction->LPA),
                                              old_ppa);
 
         block_manager->Read_transaction_issued(read_tr->Address);//Inform block manager about a new transaction as soon as the transaction's target address is determined
@@ -513,11 +656,11 @@ Address_Mapping_Unit_Page_Level::request_mapping_entry(stream_id_type stream_id,
         * will access the evicted lpa in the near future (before the translation
         * write finishes), MQSim updates GMT (the on flash mapping table) right
         * after eviction happens.*/
-        domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-        domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-        if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+        domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+        domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+        if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
           throw std::logic_error("Unexpected situation occurred in handling GMT!");
-        domain.GlobalMappingTable[evicted_lpa].TimeStamp = CurrentTimeStamp;
+        domain.GlobalMappingTable.Set_timestamp(evicted_lpa, CurrentTimeStamp);
         generate_flash_writeback_request_for_mapping_data(stream_id, evicted_lpa);
       }
     }
@@ -548,11 +691,11 @@ Address_Mapping_Unit_Page_Level::request_mapping_entry(stream_id_type stream_id,
           * will access the evicted lpa in the near future (before the translation
           * write finishes), MQSim updates GMT (the on flash mapping table) right
           * after eviction happens.*/
-          domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-          domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-          if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+          domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+          domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+          if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
             throw std::logic_error("Unexpected situation occured in handling GMT!");
-          domain.GlobalMappingTable[evicted_lpa].TimeStamp = CurrentTimeStamp;
+          domain.GlobalMappingTable.Set_timestamp(evicted_lpa, CurrentTimeStamp);
           generate_flash_writeback_request_for_mapping_data(stream_id, evicted_lpa);
         }
       }
@@ -577,11 +720,11 @@ Address_Mapping_Unit_Page_Level::request_mapping_entry(stream_id_type stream_id,
         * will access the evicted lpa in the near future (before the translation
         * write finishes), MQSim updates GMT (the on flash mapping table) right
         * after eviction happens.*/
-        domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-        domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-        if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+        domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+        domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+        if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
           throw std::logic_error("Unexpected situation occured in handling GMT!");
-        domain.GlobalMappingTable[lpa].TimeStamp = CurrentTimeStamp;
+        domain.GlobalMappingTable.Set_timestamp(lpa, CurrentTimeStamp);
         generate_flash_writeback_request_for_mapping_data(stream_id, evicted_lpa);
       }
     }
@@ -589,7 +732,7 @@ Address_Mapping_Unit_Page_Level::request_mapping_entry(stream_id_type stream_id,
     /*Hack: since we do not actually save the values of translation requests, we copy the mapping
     data from GlobalMappingTable (which actually must be stored on flash)*/
     domain.CMT->Insert_new_mapping_info(stream_id, lpa,
-                                         domain.GlobalMappingTable[lpa].PPA, domain.GlobalMappingTable[lpa].WrittenStateBitmap);
+                                         domain.GlobalMappingTable.Get_ppa(lpa), domain.GlobalMappingTable.Get_bitmap(lpa));
     return true;
   }
 
@@ -604,11 +747,11 @@ Address_Mapping_Unit_Page_Level::request_mapping_entry(stream_id_type stream_id,
       * will access the evicted lpa in the near future (before the translation
       * write finishes), MQSim updates GMT (the on flash mapping table) right
       * after eviction happens.*/
-      domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-      domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-      if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+      domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+      domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+      if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
         throw std::logic_error("Unexpected situation occured in handling GMT!");
-      domain.GlobalMappingTable[evicted_lpa].TimeStamp = CurrentTimeStamp;
+      domain.GlobalMappingTable.Set_timestamp(evicted_lpa, CurrentTimeStamp);
       generate_flash_writeback_request_for_mapping_data(stream_id, evicted_lpa);
     }
   }
@@ -712,7 +855,7 @@ Address_Mapping_Unit_Page_Level::generate_flash_writeback_request_for_mapping_da
         if (domain.CMT->Is_dirty(stream_id, lpn_itr))
         {
           domain.CMT->Make_clean(stream_id, lpn_itr);
-          domain.GlobalMappingTable[lpn_itr].PPA = domain.CMT->Retrieve_ppa(stream_id, lpn_itr);
+          domain.GlobalMappingTable.Set_ppa(lpn_itr, domain.CMT->Retrieve_ppa(stream_id, lpn_itr));
         }
         else
         {
@@ -873,8 +1016,8 @@ Address_Mapping_Unit_Page_Level::__handle_transaction_service_signal(NvmTransact
       if (domain.CMT->Is_slot_reserved_for_lpn_and_waiting(stream_id, lpa))
       {
         domain.CMT->Insert_new_mapping_info(stream_id, lpa,
-                                             domain.GlobalMappingTable[lpa].PPA,
-                                             domain.GlobalMappingTable[lpa].WrittenStateBitmap);
+                                             domain.GlobalMappingTable.Get_ppa(lpa),
+                                             domain.GlobalMappingTable.Get_bitmap(lpa));
 
         __processing_unmapped_transactions(domain.Waiting_unmapped_read_transactions,
                                            lpa, stream_id,
@@ -1046,9 +1189,9 @@ Address_Mapping_Unit_Page_Level::Allocate_address_for_preconditioning(stream_id_
                 assigned_lpas[plane_address.ChannelID][plane_address.ChipID][plane_address.DieID][plane_address.PlaneID].pop_back();
                 PPA_type ppa = Convert_address_to_ppa(address);
                 flash_controller->Change_memory_status_preconditioning(&address, &lpa);
-                domain.GlobalMappingTable[lpa].PPA = ppa;
-                domain.GlobalMappingTable[lpa].WrittenStateBitmap = (*lpa_list.find(lpa)).second;
-                domain.GlobalMappingTable[lpa].TimeStamp = 0;
+                domain.GlobalMappingTable.Set_ppa(lpa, ppa);
+                domain.GlobalMappingTable.Set_bitmap(lpa, (*lpa_list.find(lpa)).second);
+                domain.GlobalMappingTable.Set_timestamp(lpa, 0);
               }
             }
           }
@@ -1078,7 +1221,7 @@ Address_Mapping_Unit_Page_Level::Bring_to_CMT_for_preconditioning(stream_id_type
 {
   auto& domain = domains[stream_id];
 
-  if (domain.GlobalMappingTable[lpa].PPA == NO_PPA)
+  if (domain.GlobalMappingTable.Get_ppa(lpa) == NO_PPA)
     PRINT_ERROR("Touching an unallocated logical address in preconditioning!")
 
   if (domain.CMT->Exists(stream_id, lpa))
@@ -1088,8 +1231,8 @@ Address_Mapping_Unit_Page_Level::Bring_to_CMT_for_preconditioning(stream_id_type
   {
     domain.CMT->Reserve_slot_for_lpn(stream_id, lpa);
     domain.CMT->Insert_new_mapping_info(stream_id, lpa,
-                                         domain.GlobalMappingTable[lpa].PPA,
-                                         domain.GlobalMappingTable[lpa].WrittenStateBitmap);
+                                         domain.GlobalMappingTable.Get_ppa(lpa),
+                                         domain.GlobalMappingTable.Get_bitmap(lpa));
   }
   else
   {
@@ -1097,8 +1240,8 @@ Address_Mapping_Unit_Page_Level::Bring_to_CMT_for_preconditioning(stream_id_type
     domain.CMT->Evict_one_slot(evicted_lpa);
     domain.CMT->Reserve_slot_for_lpn(stream_id, lpa);
     domain.CMT->Insert_new_mapping_info(stream_id, lpa,
-                                         domain.GlobalMappingTable[lpa].PPA,
-                                         domain.GlobalMappingTable[lpa].WrittenStateBitmap);
+                                         domain.GlobalMappingTable.Get_ppa(lpa),
+                                         domain.GlobalMappingTable.Get_bitmap(lpa));
   }
   domain.No_of_inserted_entries_in_preconditioning++;
   return domain.No_of_inserted_entries_in_preconditioning;
@@ -1130,6 +1273,30 @@ Address_Mapping_Unit_Page_Level::Store_mapping_table_on_flash_at_start()
   mapping_table_stored_on_flash = true;
 }
 
+void
+Address_Mapping_Unit_Page_Level::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  writer.write_section("AMU");
+  writer.write(no_of_input_streams);
+  writer.write(ideal_mapping_table);
+  writer.write(mapping_table_stored_on_flash);
+
+  for (auto& domain : domains)
+    domain.Save_checkpoint(writer);
+}
+
+void
+Address_Mapping_Unit_Page_Level::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  reader.read_section("AMU");
+  reader.expect(no_of_input_streams, "I/O flows");
+  reader.expect(ideal_mapping_table, "ideal mapping table");
+  mapping_table_stored_on_flash = reader.read<bool>();
+
+  for (auto& domain : domains)
+    domain.Load_checkpoint(reader);
+}
+
 uint32_t
 Address_Mapping_Unit_Page_Level::Get_cmt_capacity()
 {
@@ -1142,6 +1309,17 @@ Address_Mapping_Unit_Page_Level::Get_current_cmt_occupancy_for_stream(stream_id_
   return domains[stream_id].No_of_inserted_entries_in_preconditioning;
 }
 
+uint32_t
+Address_Mapping_Unit_Page_Level::Get_current_cmt_occupancy()
+{
+  uint32_t occupancy = 0;
+
+  for (auto& domain : domains)
+    occupancy += domain.CMT->Size();
+
+  return occupancy;
+}
+
 LPA_type
 Address_Mapping_Unit_Page_Level::Get_logical_pages_count(stream_id_type stream_id)
 {
@@ -1192,8 +1370,8 @@ Address_Mapping_Unit_Page_Level::Get_data_mapping_info_for_gc(stream_id_type str
     ppa = domain.Get_ppa(ideal_mapping_table, stream_id, lpa);
     page_state = domain.Get_page_status(ideal_mapping_table, stream_id, lpa);
   } else {
-    ppa = domain.GlobalMappingTable[lpa].PPA;
-    page_state = domain.GlobalMappingTable[lpa].WrittenStateBitmap;
+    ppa = domain.GlobalMappingTable.Get_ppa(lpa);
+    page_state = domain.GlobalMappingTable.Get_bitmap(lpa);
   }
 }
 
@@ -1236,11 +1414,11 @@ Address_Mapping_Unit_Page_Level::Allocate_new_page_for_gc(NvmTransactionFlashWR*
           * will access the evicted lpa in the near future (before the translation
           * write finishes), MQSim updates GMT (the on flash mapping table) right
           * after eviction happens.*/
-          domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-          domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-          if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+          domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+          domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+          if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
             throw std::logic_error("Unexpected situation occured in handling GMT!");
-          domain.GlobalMappingTable[evicted_lpa].TimeStamp = CurrentTimeStamp;
+          domain.GlobalMappingTable.Set_timestamp(evicted_lpa, CurrentTimeStamp);
           generate_flash_writeback_request_for_mapping_data(transaction->Stream_id, evicted_lpa);
         }
       }
@@ -1278,11 +1456,11 @@ Address_Mapping_Unit_Page_Level::Allocate_new_page_for_gc(NvmTransactionFlashWR*
           * will access the evicted lpa in the near future (before the translation
           * write finishes), MQSim updates GMT (the on flash mapping table) right
           * after eviction happens.*/
-          domain.GlobalMappingTable[evicted_lpa].PPA = evictedItem.PPA;
-          domain.GlobalMappingTable[evicted_lpa].WrittenStateBitmap = evictedItem.WrittenStateBitmap;
-          if (domain.GlobalMappingTable[evicted_lpa].TimeStamp > CurrentTimeStamp)
+          domain.GlobalMappingTable.Set_ppa(evicted_lpa, evictedItem.PPA);
+          domain.GlobalMappingTable.Set_bitmap(evicted_lpa, evictedItem.WrittenStateBitmap);
+          if (domain.GlobalMappingTable.Get_timestamp(evicted_lpa) > CurrentTimeStamp)
             throw std::logic_error("Unexpected situation occured in handling GMT!");
-          domain.GlobalMappingTable[evicted_lpa].TimeStamp = CurrentTimeStamp;
+          domain.GlobalMappingTable.Set_timestamp(evicted_lpa, CurrentTimeStamp);
           generate_flash_writeback_request_for_mapping_data(stream_id, evicted_lpa);
         }
       }
@@ -1364,7 +1542,7 @@ Address_Mapping_Unit_Page_Level::Set_barrier_for_accessing_physical_block(const
       else
       {
         LPA_type lpa = flash_controller->Get_metadata(addr.ChannelID, addr.ChipID, addr.DieID, addr.PlaneID, addr.BlockID, addr.PageID);
-        LPA_type ppa = domain.GlobalMappingTable[lpa].PPA;
+        LPA_type ppa = domain.GlobalMappingTable.Get_ppa(lpa);
         if (domain.CMT->Exists(block.Stream_id, lpa))
           ppa = domain.CMT->Retrieve_ppa(block.Stream_id, lpa);
         if (ppa != Convert_address_to_ppa(addr))
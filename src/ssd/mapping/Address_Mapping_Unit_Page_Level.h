@@ -10,14 +10,18 @@
 
 // Refined header list
 #include <cstdint>
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "../../utils/Logical_Address_Partitioning_Unit.h"
 #include "../phy/PhyHandler.h"
 #include "AddressMappingUnitDefs.h"
+#include "GlobalMappingTable.h"
 
 #include "Address_Mapping_Unit_Base.h"
 
@@ -39,24 +43,26 @@ namespace SSD_Components
     unsigned long long WrittenStateBitmap;
     bool Dirty;
     CMTEntryStatus Status;
-    std::list<std::pair<LPA_type, CMTSlotType*>>::iterator listPtr;//used for fast implementation of LRU
     stream_id_type Stream_id;
-  };
-
-  struct GMTEntryType//Entry type for the Global Mapping Table
-  {
-    PPA_type PPA;
-    uint64_t WrittenStateBitmap;
-    data_timestamp_type TimeStamp;
 
-    GMTEntryType();
+    LPA_type Key;   // Unique key (stream id and lpa) of this slot
+    uint32_t Prev;  // Intrusive LRU list links (slot indexes)
+    uint32_t Next;
   };
-  
+
+  /*
+   * Cached mapping table is a fixed capacity, open addressing hash table.
+   * The hash index (key and slot number pairs) is sized from the capacity at
+   * construction and kept under the half load, so linear probing stops soon
+   * and no rehashing is required. Slots are stored inline in an arena which
+   * grows up to the capacity and recycles the evicted slots, and the LRU
+   * list is linked through the slot indexes inside the slots.
+   */
   class Cached_Mapping_Table
   {
   public:
     Cached_Mapping_Table(uint32_t capacity);
-    ~Cached_Mapping_Table();
+    ~Cached_Mapping_Table() = default;
     bool Exists(const stream_id_type streamID, const LPA_type lpa);
     PPA_type Retrieve_ppa(const stream_id_type streamID, const LPA_type lpa);
     void Update_mapping_info(const stream_id_type streamID, const LPA_type lpa, const PPA_type ppa, const page_status_type pageWriteState);
@@ -65,15 +71,44 @@ namespace SSD_Components
 
     bool Is_slot_reserved_for_lpn_and_waiting(const stream_id_type streamID, const LPA_type lpa);
     bool Check_free_slot_availability();
+    uint32_t Size() const;
     void Reserve_slot_for_lpn(const stream_id_type streamID, const LPA_type lpa);
     CMTSlotType Evict_one_slot(LPA_type& lpa);
     
     bool Is_dirty(const stream_id_type streamID, const LPA_type lpa);
     void Make_clean(const stream_id_type streamID, const LPA_type lpa);
+
+    // Entries are stored from the least recently used one, so restoring them
+    // in order rebuilds the same LRU list.
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
   private:
-    std::unordered_map<LPA_type, CMTSlotType*> addressMap;
-    std::list<std::pair<LPA_type, CMTSlotType*>> lruList;
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    struct Bucket
+    {
+      LPA_type key;
+      uint32_t slot;
+    };
+
+    std::vector<Bucket> buckets;
+    uint64_t bucketMask;
+    uint32_t hashShift;
+
+    std::vector<CMTSlotType> slots;
+    uint32_t freeSlots;   // Head of the recycled slot list (linked by Next)
+    uint32_t lruHead;     // Most recently used slot
+    uint32_t lruTail;     // Least recently used slot
+    uint32_t size;
     uint32_t capacity;
+
+    uint64_t home_bucket(LPA_type key) const;
+    uint64_t find_bucket(LPA_type key) const;
+    CMTSlotType* find_slot(LPA_type key);
+    void erase_bucket(uint64_t pos);
+
+    void lru_unlink(uint32_t slot);
+    void lru_push_front(uint32_t slot);
   };
 
   /* Each stream has its own address mapping domain. It helps isolation of GC interference
@@ -96,7 +131,9 @@ namespace SSD_Components
                          const PlaneIDs& plane_ids,
                          PPA_type total_physical_sectors_no,
                          LHA_type total_logical_sectors_no,
-                         uint32_t sectors_no_per_page);
+                         uint32_t sectors_no_per_page,
+                         PPA_type device_physical_pages_no,
+                         const std::string& gmt_backing_dir);
     ~AddressMappingDomain();
 
     LHA_type max_logical_sector_address;
@@ -111,7 +148,7 @@ namespace SSD_Components
 
     /*The logical to physical address mapping of all data pages that is implemented based on the DFTL (Gupta et al., ASPLOS 2009(
     * proposal. It is always stored in non-volatile flash memory.*/
-    std::vector<GMTEntryType> GlobalMappingTable;
+    SSD_Components::GlobalMappingTable GlobalMappingTable;
 
     /*The cached mapping table that is implemented based on the DFLT (Gupta et al., ASPLOS 2009) proposal.
     * It is always stored in volatile memory.*/
@@ -126,6 +163,9 @@ namespace SSD_Components
     PPA_type Get_ppa_for_preconditioning(const stream_id_type stream_id, const LPA_type lpa);
     bool Mapping_entry_accessible(const bool ideal_mapping, const stream_id_type stream_id, const LPA_type lpa);
 
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
+
 
     FlashTransactionLpaMap Waiting_unmapped_read_transactions;
     FlashTransactionLpaMap Waiting_unmapped_program_transactions;
@@ -164,7 +204,9 @@ namespace SSD_Components
 
     uint32_t cmt_capacity;
 
-    std::vector<AddressMappingDomain> domains;
+    // Domains own non-copyable mapping tables, so they are constructed in
+    // place and never relocated.
+    std::deque<AddressMappingDomain> domains;
     uint32_t CMT_entry_size, GTD_entry_size;//In CMT MQSim stores (lpn, ppn, page status bits) but in GTD it only stores (ppn, page status bits)
 
     std::set<NvmTransactionFlashWR*>**** Write_transactions_for_overfull_planes;
@@ -228,7 +270,8 @@ namespace SSD_Components
                                     uint32_t PageSizeInBytes,
                                     double Overprovisioning_ratio,
                                     CMT_Sharing_Mode sharing_mode = CMT_Sharing_Mode::SHARED,
-                                    bool fold_large_addresses = true);
+                                    bool fold_large_addresses = true,
+                                    const std::string& gmt_backing_dir = "");
     ~Address_Mapping_Unit_Page_Level() final = default;
 
     // --------------------------
@@ -249,9 +292,13 @@ namespace SSD_Components
 
     void Store_mapping_table_on_flash_at_start() final;
 
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const final;
+    void Load_checkpoint(Utils::CheckpointReader& reader) final;
+
     uint32_t Get_cmt_capacity() final;
 
     uint32_t Get_current_cmt_occupancy_for_stream(stream_id_type stream_id) final;
+    uint32_t Get_current_cmt_occupancy() final;
 
     LPA_type Get_logical_pages_count(stream_id_type stream_id) final;
 
@@ -0,0 +1,139 @@
+#include "GlobalMappingTable.h"
+
+#include <algorithm>
+
+#include "../../utils/Exception.h"
+
+using namespace SSD_Components;
+
+constexpr uint32_t GlobalMappingTable::TIMESTAMP_BYTES;
+constexpr uint32_t GlobalMappingTable::STATE_BITS;
+constexpr size_t GlobalMappingTable::CHECKPOINT_CHUNK;
+
+namespace {
+  constexpr uint64_t END_OF_CHUNKS = UINT64_MAX;
+}
+
+force_inline uint32_t
+__bits_for(uint64_t max_value)
+{
+  uint32_t bits = 1;
+
+  while (bits < 64 && (max_value >> bits) != 0)
+    ++bits;
+
+  return bits;
+}
+
+GlobalMappingTable::GlobalMappingTable(LPA_type logical_pages,
+                                       PPA_type physical_pages,
+                                       uint32_t sectors_per_page,
+                                       const std::string& backing_dir)
+  : __ppa_bits(__bits_for(physical_pages)),
+    __field_bytes((__ppa_bits + STATE_BITS + 7) / 8),
+    __entry_bytes(TIMESTAMP_BYTES + __field_bytes),
+    __ppa_mask((1ULL << __ppa_bits) - 1),
+    __full_page(sectors_per_page < 64
+                  ? (1ULL << sectors_per_page) - 1
+                  : FULL_PROGRAMMED_PAGE),
+    __buffer(),
+    __partial_pages()
+{
+  if (64 < __ppa_bits + STATE_BITS)
+    throw mqsim_error("Too many physical pages for the global mapping table");
+
+  __buffer.allocate(logical_pages * __entry_bytes, backing_dir);
+}
+
+void
+GlobalMappingTable::Set_ppa(LPA_type lpa, PPA_type ppa)
+{
+  uint64_t field = __load_field(lpa) & ~__ppa_mask;
+
+  if (ppa != NO_PPA) {
+    if (__ppa_mask <= ppa)
+      throw mqsim_error("PPA out of the global mapping table range: "
+                        + std::to_string(ppa));
+
+    field |= ppa + 1;
+  }
+
+  __store_field(lpa, field);
+}
+
+void
+GlobalMappingTable::Set_bitmap(LPA_type lpa, page_status_type bitmap)
+{
+  uint64_t state;
+
+  if (bitmap == UNWRITTEN_LOGICAL_PAGE)
+    state = UNWRITTEN;
+  else if (bitmap == __full_page)
+    state = FULL;
+  else
+    state = PARTIAL;
+
+  if (state == PARTIAL)
+    __partial_pages[lpa] = bitmap;
+  else if (__load_field(lpa) >> __ppa_bits == PARTIAL)
+    __partial_pages.erase(lpa);
+
+  __store_field(lpa, (__load_field(lpa) & __ppa_mask) | (state << __ppa_bits));
+}
+
+void
+GlobalMappingTable::Save_checkpoint(Utils::CheckpointWriter& writer) const
+{
+  writer.write_section("GMT");
+  writer.write<uint64_t>(__buffer.size());
+  writer.write(__entry_bytes);
+
+  const char* data = __buffer.data();
+
+  for (size_t offset = 0; offset < __buffer.size(); offset += CHECKPOINT_CHUNK) {
+    size_t length = std::min(CHECKPOINT_CHUNK, __buffer.size() - offset);
+    const char* chunk = data + offset;
+
+    if (chunk[0] == 0 && std::memcmp(chunk, chunk + 1, length - 1) == 0)
+      continue;
+
+    writer.write<uint64_t>(offset);
+    writer.write_bytes(chunk, length);
+  }
+
+  writer.write(END_OF_CHUNKS);
+
+  writer.write<uint64_t>(__partial_pages.size());
+
+  for (const auto& page : __partial_pages) {
+    writer.write(page.first);
+    writer.write(page.second);
+  }
+}
+
+void
+GlobalMappingTable::Load_checkpoint(Utils::CheckpointReader& reader)
+{
+  reader.read_section("GMT");
+  reader.expect<uint64_t>(__buffer.size(), "global mapping table size");
+  reader.expect(__entry_bytes, "global mapping table entry size");
+
+  char* data = __buffer.data();
+
+  for (uint64_t offset = reader.read<uint64_t>();
+       offset != END_OF_CHUNKS;
+       offset = reader.read<uint64_t>()) {
+    if (__buffer.size() <= offset)
+      throw mqsim_error("Corrupted global mapping table in the checkpoint");
+
+    reader.read_bytes(data + offset,
+                      std::min(CHECKPOINT_CHUNK, __buffer.size() - offset));
+  }
+
+  __partial_pages.clear();
+
+  for (uint64_t count = reader.read<uint64_t>(); 0 < count; --count) {
+    auto lpa = reader.read<LPA_type>();
+    __partial_pages[lpa] = reader.read<page_status_type>();
+  }
+}
@@ -0,0 +1,164 @@
+//
+// GlobalMappingTable
+// MQSim
+//
+
+#ifndef __MQSim__GlobalMappingTable__
+#define __MQSim__GlobalMappingTable__
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "../../sim/Sim_Defs.h"
+#include "../../utils/Checkpoint.h"
+#include "../../utils/InlineTools.h"
+#include "../../utils/MappedBuffer.h"
+#include "../../nvm_chip/flash_memory/FlashTypes.h"
+
+namespace SSD_Components
+{
+  // ==========================================================================
+  // Global Mapping Table (GMT)
+  //
+  // The logical to physical address mapping of all data pages stored in the
+  // flash memory. Each entry is packed into a fixed size record:
+  //
+  //   | timestamp (8 bytes) | ppa + 1 (ppa bits) | page state (2 bits) |
+  //
+  // The ppa field width comes from the number of physical pages, and zero
+  // means NO_PPA. The page state tells whether the logical page is
+  // unwritten, fully written or partially written, and only the partially
+  // written pages keep their sector bitmap in a side table. A fresh entry is
+  // all zero, so the table buffer is allocated lazily by the kernel and can
+  // be backed by a sparse file.
+  // ==========================================================================
+  class GlobalMappingTable {
+  private:
+    enum PageState : uint64_t {
+      UNWRITTEN = 0,
+      FULL      = 1,
+      PARTIAL   = 2
+    };
+
+    static constexpr uint32_t TIMESTAMP_BYTES = sizeof(data_timestamp_type);
+    static constexpr uint32_t STATE_BITS = 2;
+
+    // Granularity of the sparse table encoding in the checkpoint.
+    static constexpr size_t CHECKPOINT_CHUNK = 64 * 1024;
+
+  private:
+    const uint32_t         __ppa_bits;
+    const uint32_t         __field_bytes;
+    const uint32_t         __entry_bytes;
+    const uint64_t         __ppa_mask;
+    const page_status_type __full_page;
+
+    Utils::MappedBuffer __buffer;
+
+    std::unordered_map<LPA_type, page_status_type> __partial_pages;
+
+  private:
+    char* __entry(LPA_type lpa);
+    const char* __entry(LPA_type lpa) const;
+
+    uint64_t __load_field(LPA_type lpa) const;
+    void __store_field(LPA_type lpa, uint64_t field);
+
+  public:
+    GlobalMappingTable(LPA_type logical_pages,
+                       PPA_type physical_pages,
+                       uint32_t sectors_per_page,
+                       const std::string& backing_dir);
+
+    PPA_type Get_ppa(LPA_type lpa) const;
+    page_status_type Get_bitmap(LPA_type lpa) const;
+    data_timestamp_type Get_timestamp(LPA_type lpa) const;
+
+    void Set_ppa(LPA_type lpa, PPA_type ppa);
+    void Set_bitmap(LPA_type lpa, page_status_type bitmap);
+    void Set_timestamp(LPA_type lpa, data_timestamp_type timestamp);
+
+    // Size of a packed entry in bytes.
+    uint32_t Entry_size() const;
+
+    // Only the non-zero chunks of the table are stored, so the checkpoint of
+    // a sparsely written drive stays small.
+    void Save_checkpoint(Utils::CheckpointWriter& writer) const;
+    void Load_checkpoint(Utils::CheckpointReader& reader);
+  };
+
+  force_inline char*
+  GlobalMappingTable::__entry(LPA_type lpa)
+  {
+    return __buffer.data() + lpa * __entry_bytes;
+  }
+
+  force_inline const char*
+  GlobalMappingTable::__entry(LPA_type lpa) const
+  {
+    return __buffer.data() + lpa * __entry_bytes;
+  }
+
+  force_inline uint64_t
+  GlobalMappingTable::__load_field(LPA_type lpa) const
+  {
+    auto pos = reinterpret_cast<const uint8_t*>(__entry(lpa)) + TIMESTAMP_BYTES;
+    uint64_t field = 0;
+
+    for (uint32_t i = 0; i < __field_bytes; ++i)
+      field |= uint64_t(pos[i]) << (8 * i);
+
+    return field;
+  }
+
+  force_inline void
+  GlobalMappingTable::__store_field(LPA_type lpa, uint64_t field)
+  {
+    auto pos = reinterpret_cast<uint8_t*>(__entry(lpa)) + TIMESTAMP_BYTES;
+
+    for (uint32_t i = 0; i < __field_bytes; ++i)
+      pos[i] = uint8_t(field >> (8 * i));
+  }
+
+  force_inline PPA_type
+  GlobalMappingTable::Get_ppa(LPA_type lpa) const
+  {
+    uint64_t ppa = __load_field(lpa) & __ppa_mask;
+
+    return ppa == 0 ? NO_PPA : ppa - 1;
+  }
+
+  force_inline page_status_type
+  GlobalMappingTable::Get_bitmap(LPA_type lpa) const
+  {
+    switch (__load_field(lpa) >> __ppa_bits) {
+    case UNWRITTEN: return UNWRITTEN_LOGICAL_PAGE;
+    case FULL:      return __full_page;
+    default:        return __partial_pages.at(lpa);
+    }
+  }
+
+  force_inline data_timestamp_type
+  GlobalMappingTable::Get_timestamp(LPA_type lpa) const
+  {
+    data_timestamp_type timestamp;
+    std::memcpy(&timestamp, __entry(lpa), TIMESTAMP_BYTES);
+
+    return timestamp;
+  }
+
+  force_inline void
+  GlobalMappingTable::Set_timestamp(LPA_type lpa, data_timestamp_type timestamp)
+  {
+    std::memcpy(__entry(lpa), &timestamp, TIMESTAMP_BYTES);
+  }
+
+  force_inline uint32_t
+  GlobalMappingTable::Entry_size() const
+  {
+    return __entry_bytes;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__GlobalMappingTable__ */
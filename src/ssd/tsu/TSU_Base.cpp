@@ -3,6 +3,7 @@
 #include "../FTL.h"
 
 // Children classes for builder
+#include "TSU_FLIN.h"
 #include "TSU_OutofOrder.h"
 
 using namespace SSD_Components;
@@ -74,18 +75,44 @@ TSU_Base::__handle_chip_idle_signal(const NVM::FlashMemory::Flash_Chip& chip)
 TSUPtr
 SSD_Components::build_tsu_object(const DeviceParameterSet& params,
                                  FTL& ftl,
-                                 NVM_PHY_ONFI& nvm_controller)
+                                 NVM_PHY_ONFI& nvm_controller,
+                                 uint32_t stream_count)
 {
-  return std::make_shared<TSU_OutOfOrder>(ftl.ID() + ".TSU",
-                                          ftl,
-                                          nvm_controller,
-                                          params.Flash_Channel_Count,
-                                          params.Chip_No_Per_Channel,
-                                          params.Flash_Parameters.Die_No_Per_Chip,
-                                          params.Flash_Parameters.Plane_No_Per_Die,
-                                          params.Preferred_suspend_write_time_for_read,
-                                          params.Preferred_suspend_erase_time_for_read,
-                                          params.Preferred_suspend_erase_time_for_write,
-                                          params.Flash_Parameters.erase_suspension_support(),
-                                          params.Flash_Parameters.program_suspension_support());
-}
\ No newline at end of file
+  switch (params.Transaction_Scheduling_Policy) {
+  case Flash_Scheduling_Type::FLIN:
+    return std::make_shared<TSU_FLIN>(ftl.ID() + ".TSU",
+                                      ftl,
+                                      nvm_controller,
+                                      params.Flash_Channel_Count,
+                                      params.Chip_No_Per_Channel,
+                                      params.Flash_Parameters.Die_No_Per_Chip,
+                                      params.Flash_Parameters.Plane_No_Per_Die,
+                                      stream_count,
+                                      params.FLIN_Flow_Classification_Epoch,
+                                      params.FLIN_Alpha_Read,
+                                      params.FLIN_Alpha_Write,
+                                      params.FLIN_Fairness_Threshold,
+                                      params.Flash_Parameters.avg_read_latency(),
+                                      params.Flash_Parameters.avg_write_latency(),
+                                      params.Preferred_suspend_write_time_for_read,
+                                      params.Preferred_suspend_erase_time_for_read,
+                                      params.Preferred_suspend_erase_time_for_write,
+                                      params.Flash_Parameters.erase_suspension_support(),
+                                      params.Flash_Parameters.program_suspension_support());
+
+  case Flash_Scheduling_Type::OUT_OF_ORDER:
+  default:
+    return std::make_shared<TSU_OutOfOrder>(ftl.ID() + ".TSU",
+                                            ftl,
+                                            nvm_controller,
+                                            params.Flash_Channel_Count,
+                                            params.Chip_No_Per_Channel,
+                                            params.Flash_Parameters.Die_No_Per_Chip,
+                                            params.Flash_Parameters.Plane_No_Per_Die,
+                                            params.Preferred_suspend_write_time_for_read,
+                                            params.Preferred_suspend_erase_time_for_read,
+                                            params.Preferred_suspend_erase_time_for_write,
+                                            params.Flash_Parameters.erase_suspension_support(),
+                                            params.Flash_Parameters.program_suspension_support());
+  }
+}
@@ -14,6 +14,15 @@
 namespace SSD_Components
 {
   class FTL;
+
+  // Number of the transactions waiting in the queues of a chip
+  struct ChipQueueLengths {
+    uint32_t User_read;
+    uint32_t User_write;
+    uint32_t Mapping;
+    uint32_t GC;
+  };
+
   class TSU_Base : public MQSimEngine::Sim_Object
   {
   private:
@@ -107,6 +116,9 @@ namespace SSD_Components
      * The transactions could be mixes of reads, writes, and erases.
      */
     virtual void Schedule() = 0;
+
+    virtual ChipQueueLengths Get_queue_lengths(flash_channel_ID_type channel_id,
+                                               flash_chip_ID_type chip_id) const = 0;
   };
 
   force_inline bool
@@ -170,7 +182,8 @@ namespace SSD_Components
 
   TSUPtr build_tsu_object(const DeviceParameterSet& params,
                           FTL& ftl,
-                          NVM_PHY_ONFI& nvm_controller);
+                          NVM_PHY_ONFI& nvm_controller,
+                          uint32_t stream_count);
 }
 
 #endif //TSU_H
@@ -43,8 +43,7 @@ to_scheduling_policy(std::string v)
   Utils::to_upper(v);
 
   STR_TO_ENUM(Flash_Scheduling_Type, OUT_OF_ORDER);
-  // Currently FLIN Scheduling type had been all commented out!
-  // STR_TO_ENUM(Flash_Scheduling_Type, FLIN);
+  STR_TO_ENUM(Flash_Scheduling_Type, FLIN);
 
   throw mqsim_error("Unknown transaction scheduling type specified in the SSD "
                     "configuration file");
@@ -0,0 +1,658 @@
+#include "TSU_FLIN.h"
+
+#include "../FTL.h"
+
+namespace
+{
+  // Service order of the HIGH, MEDIUM and LOW priority classes in a round of
+  // the weighted round-robin arbitration, with the 4:2:1 weights.
+  const uint32_t WRR_ROUND[] = { 1, 2, 1, 3, 1, 2, 1 };
+  constexpr uint32_t WRR_ROUND_LENGTH = sizeof(WRR_ROUND) / sizeof(WRR_ROUND[0]);
+
+  constexpr uint32_t URGENT_CLASS = 0;
+}
+
+namespace SSD_Components
+{
+  TSU_FLIN::ChipQueues::ChipQueues()
+    : Read_turn(0),
+      Write_turn(0)
+  { }
+
+  TSU_FLIN::FlowStatistics::FlowStatistics()
+    : Priority_class(IO_Flow_Priority_Class::HIGH),
+      Dispatched_transactions(0),
+      Shared_time(0),
+      Alone_time(0)
+  { }
+
+  double TSU_FLIN::FlowStatistics::Slowdown() const
+  {
+    return Alone_time == 0 ? 1.0 : double(Shared_time) / double(Alone_time);
+  }
+
+  TSU_FLIN::TSU_FLIN(const sim_object_id_type& id, FTL& ftl, NVM_PHY_ONFI& NVMController, uint32_t ChannelCount, uint32_t chip_no_per_channel,
+    uint32_t DieNoPerChip, uint32_t PlaneNoPerDie, uint32_t stream_count,
+    sim_time_type flow_classification_epoch, uint32_t alpha_read, uint32_t alpha_write, double fairness_threshold,
+    sim_time_type read_service_time, sim_time_type write_service_time,
+    sim_time_type WriteReasonableSuspensionTimeForRead,
+    sim_time_type EraseReasonableSuspensionTimeForRead,
+    sim_time_type EraseReasonableSuspensionTimeForWrite,
+    bool EraseSuspensionEnabled, bool ProgramSuspensionEnabled)
+    : TSU_Base(id, ftl, NVMController, Flash_Scheduling_Type::FLIN, ChannelCount, chip_no_per_channel, DieNoPerChip, PlaneNoPerDie,
+      EraseSuspensionEnabled, ProgramSuspensionEnabled,
+      WriteReasonableSuspensionTimeForRead, EraseReasonableSuspensionTimeForRead, EraseReasonableSuspensionTimeForWrite),
+      __flow_classification_epoch(flow_classification_epoch),
+      __alpha_read(alpha_read),
+      __alpha_write(alpha_write),
+      __fairness_threshold(fairness_threshold),
+      __read_service_time(read_service_time),
+      __write_service_time(write_service_time),
+      __queues(ChannelCount),
+      __flows(stream_count),
+      __epoch_start(0),
+      __alone_wait(stream_count),
+      __flow_slowdown(stream_count)
+  {
+    if (__flow_classification_epoch == 0)
+      throw mqsim_error("The FLIN flow classification epoch should be larger than 0");
+
+    for (uint32_t channelID = 0; channelID < channel_count; channelID++)
+    {
+      // ChipQueues is not movable, so the vector is sized at once
+      std::vector<ChipQueues>(chip_no_per_channel).swap(__queues[channelID]);
+
+      for (uint32_t chip_cntr = 0; chip_cntr < chip_no_per_channel; chip_cntr++)
+      {
+        auto& chip = __queues[channelID][chip_cntr];
+        std::string suffix = "@" + std::to_string(channelID) + "@" + std::to_string(chip_cntr);
+
+        for (uint32_t cls = 0; cls < PRIORITY_CLASS_COUNT; cls++)
+        {
+          std::string class_name = to_string(IO_Flow_Priority_Class(cls + 1));
+          chip.User_read[cls].Set_id("User_Read_TR_Queue" + suffix + "@" + class_name);
+          chip.User_write[cls].Set_id("User_Write_TR_Queue" + suffix + "@" + class_name);
+        }
+        chip.Mapping_read.Set_id("Mapping_Read_TR_Queue" + suffix);
+        chip.Mapping_write.Set_id("Mapping_Write_TR_Queue" + suffix);
+        chip.GC_read.Set_id("GC_Read_TR_Queue" + suffix);
+        chip.GC_write.Set_id("GC_Write_TR_Queue" + suffix);
+        chip.GC_erase.Set_id("GC_Erase_TR_Queue" + suffix);
+
+        for (stream_id_type stream_id = 0; stream_id < stream_count; stream_id++)
+          __reserve_flow(chip, stream_id);
+      }
+    }
+  }
+
+  force_inline TSU_FLIN::ChipQueues&
+  TSU_FLIN::__chip_queues(const NVM::FlashMemory::Physical_Page_Address& address)
+  {
+    return __queues[address.ChannelID][address.ChipID];
+  }
+
+  force_inline TSU_FLIN::ChipQueues&
+  TSU_FLIN::__chip_queues(const NVM::FlashMemory::Flash_Chip& chip)
+  {
+    return __queues[chip.ChannelID][chip.ChipID];
+  }
+
+  void TSU_FLIN::__reserve_flow(ChipQueues& chip, stream_id_type stream_id)
+  {
+    if (stream_id < chip.Read_arrivals.size())
+      return;
+
+    chip.Read_arrivals.resize(stream_id + 1, 0);
+    chip.Write_arrivals.resize(stream_id + 1, 0);
+    chip.High_intensity_read.resize(stream_id + 1, false);
+    chip.High_intensity_write.resize(stream_id + 1, false);
+
+    if (__flows.size() <= stream_id) {
+      __flows.resize(stream_id + 1);
+      __alone_wait.resize(stream_id + 1);
+      __flow_slowdown.resize(stream_id + 1);
+    }
+  }
+
+  void TSU_FLIN::__update_epoch()
+  {
+    sim_time_type elapsed = Simulator->Time() - __epoch_start;
+
+    if (elapsed < __flow_classification_epoch)
+      return;
+
+    for (auto& channel : __queues)
+      for (auto& chip : channel)
+        for (stream_id_type stream_id = 0; stream_id < chip.Read_arrivals.size(); stream_id++)
+        {
+          chip.High_intensity_read[stream_id] = chip.Read_arrivals[stream_id] > __alpha_read;
+          chip.High_intensity_write[stream_id] = chip.Write_arrivals[stream_id] > __alpha_write;
+          chip.Read_arrivals[stream_id] = 0;
+          chip.Write_arrivals[stream_id] = 0;
+        }
+
+    __epoch_start += elapsed - elapsed % __flow_classification_epoch;
+  }
+
+  force_inline uint32_t
+  TSU_FLIN::__priority_index(NvmTransactionFlash* transaction)
+  {
+    auto& flow = __flows[transaction->Stream_id];
+
+    // The transactions of the cache write-back have no user request, so the
+    // last known class of the flow is used for them.
+    if (transaction->UserIORequest != nullptr)
+      flow.Priority_class = transaction->UserIORequest->Priority_class;
+
+    return uint32_t(flow.Priority_class) - 1;
+  }
+
+  force_inline sim_time_type
+  TSU_FLIN::__service_time(NvmTransactionFlash* transaction)
+  {
+    return (transaction->Type == Transaction_Type::READ ? __read_service_time : __write_service_time)
+             + _NVMController.Expected_transfer_time(transaction);
+  }
+
+  force_inline double
+  TSU_FLIN::__proportional_wait(NvmTransactionFlash* transaction)
+  {
+    sim_time_type service_time = __service_time(transaction);
+    sim_time_type waiting_time = Simulator->Time() - transaction->Queue_hook.Enqueue_time;
+
+    return double(waiting_time + service_time) / double(service_time);
+  }
+
+  force_inline bool
+  TSU_FLIN::__is_high_intensity(const ChipQueues& chip, NvmTransactionFlash* transaction) const
+  {
+    return transaction->Type == Transaction_Type::READ
+             ? chip.High_intensity_read[transaction->Stream_id]
+             : chip.High_intensity_write[transaction->Stream_id];
+  }
+
+  void TSU_FLIN::__insert_user_transaction(ChipQueues& chip, NvmTransactionFlash* transaction)
+  {
+    __reserve_flow(chip, transaction->Stream_id);
+
+    bool is_read = transaction->Type == Transaction_Type::READ;
+    if (is_read)
+      chip.Read_arrivals[transaction->Stream_id]++;
+    else
+      chip.Write_arrivals[transaction->Stream_id]++;
+
+    uint32_t cls = __priority_index(transaction);
+    auto& queue = is_read ? chip.User_read[cls] : chip.User_write[cls];
+
+    // Stage 1: the low intensity flows go after the other low intensity
+    // ones, ahead of all high intensity flows.
+    bool high_intensity = __is_high_intensity(chip, transaction);
+
+    if (high_intensity) {
+      queue.push_back(transaction);
+    } else {
+      auto position = queue.begin();
+      while (position != queue.end() && !__is_high_intensity(chip, *position))
+        ++position;
+      queue.insert(position, transaction);
+    }
+
+    __reorder_for_fairness(chip, queue, high_intensity);
+  }
+
+  void TSU_FLIN::__reorder_for_fairness(ChipQueues& chip, Flash_Transaction_Queue& queue, bool reorder)
+  {
+    for (auto transaction : queue) {
+      __alone_wait[transaction->Stream_id] = 0;
+      __flow_slowdown[transaction->Stream_id] = 0;
+    }
+
+    // In the alone mode, a transaction waits only for the transactions of the
+    // same flow ahead of it.
+    sim_time_type shared_wait = 0;
+    for (auto transaction : queue) {
+      sim_time_type service_time = __service_time(transaction);
+      sim_time_type& alone_wait = __alone_wait[transaction->Stream_id];
+
+      transaction->Estimated_alone_waiting_time = alone_wait;
+
+      if (__is_high_intensity(chip, transaction)) {
+        double slowdown = double(shared_wait + service_time) / double(alone_wait + service_time);
+        double& flow_slowdown = __flow_slowdown[transaction->Stream_id];
+        if (flow_slowdown < slowdown)
+          flow_slowdown = slowdown;
+      }
+
+      alone_wait += service_time;
+      shared_wait += service_time;
+    }
+
+    if (!reorder)
+      return;
+
+    stream_id_type max_flow = 0, min_flow = 0;
+    double max_slowdown = 0, min_slowdown = 0;
+    bool found = false;
+
+    for (auto transaction : queue) {
+      if (!__is_high_intensity(chip, transaction))
+        continue;
+
+      double slowdown = __flow_slowdown[transaction->Stream_id];
+      if (!found || max_slowdown < slowdown) {
+        max_flow = transaction->Stream_id;
+        max_slowdown = slowdown;
+      }
+      if (!found || slowdown < min_slowdown) {
+        min_flow = transaction->Stream_id;
+        min_slowdown = slowdown;
+      }
+      found = true;
+    }
+
+    if (!found || max_flow == min_flow || __fairness_threshold <= min_slowdown / max_slowdown)
+      return;
+
+    // Move the transactions of the most slowed down flow to the head of the
+    // high intensity part, keeping their order.
+    __moved.clear();
+    auto head = queue.end();
+
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+      if (!__is_high_intensity(chip, *it))
+        continue;
+
+      if ((*it)->Stream_id != max_flow) {
+        if (head == queue.end())
+          head = it;
+      }
+      else if (head != queue.end()) {
+        __moved.push_back(*it);
+      }
+    }
+
+    for (auto transaction : __moved)
+      queue.splice(head, transaction);
+  }
+
+  Flash_Transaction_Queue*
+  TSU_FLIN::__arbitrate(Flash_Transaction_Queue* queues, uint32_t turn, uint32_t& next_turn)
+  {
+    next_turn = turn;
+
+    if (!queues[URGENT_CLASS].empty())
+      return &queues[URGENT_CLASS];
+
+    for (uint32_t i = 0; i < WRR_ROUND_LENGTH; i++) {
+      uint32_t slot = (turn + i) % WRR_ROUND_LENGTH;
+
+      if (!queues[WRR_ROUND[slot]].empty()) {
+        next_turn = (slot + 1) % WRR_ROUND_LENGTH;
+        return &queues[WRR_ROUND[slot]];
+      }
+    }
+
+    return nullptr;
+  }
+
+  void TSU_FLIN::__account_dispatched(NvmTransactionFlash* transaction)
+  {
+    if (transaction->Source != Transaction_Source_Type::USERIO
+        && transaction->Source != Transaction_Source_Type::CACHE)
+      return;
+
+    auto& flow = __flows[transaction->Stream_id];
+    sim_time_type service_time = __service_time(transaction);
+    sim_time_type waiting_time = Simulator->Time() - transaction->Queue_hook.Enqueue_time;
+
+    flow.Dispatched_transactions++;
+    flow.Shared_time += waiting_time + service_time;
+    flow.Alone_time += transaction->Estimated_alone_waiting_time + service_time;
+  }
+
+  void TSU_FLIN::__gather(Flash_Transaction_Queue& queue,
+                          flash_die_ID_type die_id,
+                          flash_page_ID_type page_id,
+                          uint32_t& plane_vector,
+                          bool is_write)
+  {
+    for (auto it = queue.begin(); it != queue.end(); )
+    {
+      auto* transaction = *it;
+
+      if ((!is_write || ((NvmTransactionFlashWR*)transaction)->RelatedRead == nullptr)
+          && transaction->Address.DieID == die_id && !(plane_vector & 1U << transaction->Address.PlaneID))
+      {
+        if (plane_vector == 0 || transaction->Address.PageID == page_id)//Check for identical pages when running multiplane command
+        {
+          plane_vector |= 1U << transaction->Address.PlaneID;
+          transaction_dispatch_slots.push_back(transaction);
+          queue.remove(it++);
+          continue;
+        }
+      }
+      it++;
+    }
+  }
+
+  void TSU_FLIN::__dispatch(Flash_Transaction_Queue* source_queue1,
+                            Flash_Transaction_Queue* source_queue2,
+                            bool is_write)
+  {
+    flash_die_ID_type dieID = source_queue1->front()->Address.DieID;
+    flash_page_ID_type pageID = source_queue1->front()->Address.PageID;
+
+    for (uint32_t i = 0; i < die_no_per_chip; i++)
+    {
+      uint32_t planeVector = 0;
+      transaction_dispatch_slots.clear();
+
+      __gather(*source_queue1, dieID, pageID, planeVector, is_write);
+
+      if (source_queue2 != nullptr && transaction_dispatch_slots.size() < plane_no_per_die)
+        __gather(*source_queue2, dieID, pageID, planeVector, is_write);
+
+      if (!transaction_dispatch_slots.empty()) {
+        for (auto transaction : transaction_dispatch_slots)
+          __account_dispatched(transaction);
+
+        _NVMController.Send_command_to_chip(transaction_dispatch_slots);
+      }
+
+      transaction_dispatch_slots.clear();
+      dieID = (dieID + 1) % die_no_per_chip;
+    }
+  }
+
+  ChipQueueLengths TSU_FLIN::Get_queue_lengths(flash_channel_ID_type channel_id,
+                                              flash_chip_ID_type chip_id) const
+  {
+    auto& chip = __queues[channel_id][chip_id];
+
+    ChipQueueLengths lengths = { 0, 0, 0, 0 };
+
+    for (uint32_t i = 0; i < PRIORITY_CLASS_COUNT; ++i) {
+      lengths.User_read += uint32_t(chip.User_read[i].size());
+      lengths.User_write += uint32_t(chip.User_write[i].size());
+    }
+
+    lengths.Mapping = uint32_t(chip.Mapping_read.size() + chip.Mapping_write.size());
+    lengths.GC = uint32_t(chip.GC_read.size()
+                            + chip.GC_write.size()
+                            + chip.GC_erase.size());
+
+    return lengths;
+  }
+
+  void TSU_FLIN::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
+  {
+    name_prefix = name_prefix + ".TSU";
+    xmlwriter.Write_open_tag(name_prefix);
+
+    TSU_Base::Report_results_in_XML(name_prefix, xmlwriter);
+
+    for (auto& channel : __queues)
+      for (auto& chip : channel)
+      {
+        for (auto& queue : chip.User_read)
+          queue.Report_results_in_XML(name_prefix + ".User_Read_TR_Queue", xmlwriter);
+        for (auto& queue : chip.User_write)
+          queue.Report_results_in_XML(name_prefix + ".User_Write_TR_Queue", xmlwriter);
+
+        chip.Mapping_read.Report_results_in_XML(name_prefix + ".Mapping_Read_TR_Queue", xmlwriter);
+        chip.Mapping_write.Report_results_in_XML(name_prefix + ".Mapping_Write_TR_Queue", xmlwriter);
+        chip.GC_read.Report_results_in_XML(name_prefix + ".GC_Read_TR_Queue", xmlwriter);
+        chip.GC_write.Report_results_in_XML(name_prefix + ".GC_Write_TR_Queue", xmlwriter);
+        chip.GC_erase.Report_results_in_XML(name_prefix + ".GC_Erase_TR_Queue", xmlwriter);
+      }
+
+    double max_slowdown = 0, min_slowdown = 0;
+    bool found = false;
+
+    for (stream_id_type stream_id = 0; stream_id < __flows.size(); stream_id++)
+    {
+      auto& flow = __flows[stream_id];
+
+      xmlwriter.Write_start_element_tag(name_prefix + ".Flow");
+      xmlwriter.Write_attribute_string_inline("Stream_ID", stream_id);
+      xmlwriter.Write_attribute_string_inline("Priority_Class", to_string(flow.Priority_class));
+      xmlwriter.Write_attribute_string_inline("Dispatched_Transactions", flow.Dispatched_transactions);
+      xmlwriter.Write_attribute_string_inline("Slowdown", flow.Slowdown());
+      xmlwriter.Write_end_element_tag();
+
+      if (flow.Dispatched_transactions == 0)
+        continue;
+
+      if (!found || max_slowdown < flow.Slowdown())
+        max_slowdown = flow.Slowdown();
+      if (!found || flow.Slowdown() < min_slowdown)
+        min_slowdown = flow.Slowdown();
+      found = true;
+    }
+
+    // Fairness is the ratio of the minimum and the maximum slowdown
+    xmlwriter.Write_start_element_tag(name_prefix + ".Fairness");
+    xmlwriter.Write_attribute_string_inline("Min_Slowdown", min_slowdown);
+    xmlwriter.Write_attribute_string_inline("Max_Slowdown", max_slowdown);
+    xmlwriter.Write_attribute_string_inline("Fairness", found ? min_slowdown / max_slowdown : 1.0);
+    xmlwriter.Write_end_element_tag();
+
+    xmlwriter.Write_close_tag();
+  }
+
+  void TSU_FLIN::Prepare_for_transaction_submit()
+  {
+    opened_scheduling_reqs++;
+    if (opened_scheduling_reqs > 1)
+      return;
+    transaction_receive_slots.clear();
+  }
+
+  void TSU_FLIN::Submit_transaction(NvmTransactionFlash* transaction)
+  {
+    transaction_receive_slots.push_back(transaction);
+  }
+
+  void TSU_FLIN::Schedule()
+  {
+    opened_scheduling_reqs--;
+    if (opened_scheduling_reqs > 0)
+      return;
+
+    // TSU_FLIN: Illegal status!
+    assert(opened_scheduling_reqs >= 0);
+
+    if (transaction_receive_slots.empty())
+      return;
+
+    __update_epoch();
+
+    for (auto transaction : transaction_receive_slots) {
+      auto& chip = __chip_queues(transaction->Address);
+
+      switch (transaction->Type)
+      {
+      case Transaction_Type::READ:
+        switch (transaction->Source)
+        {
+        case Transaction_Source_Type::CACHE:
+        case Transaction_Source_Type::USERIO:
+          __insert_user_transaction(chip, transaction);
+          break;
+        case Transaction_Source_Type::MAPPING:
+          chip.Mapping_read.push_back(transaction);
+          break;
+        case Transaction_Source_Type::GC_WL:
+          chip.GC_read.push_back(transaction);
+          break;
+        }
+        break;
+      case Transaction_Type::WRITE:
+        switch (transaction->Source)
+        {
+        case Transaction_Source_Type::CACHE:
+        case Transaction_Source_Type::USERIO:
+          __insert_user_transaction(chip, transaction);
+          break;
+        case Transaction_Source_Type::MAPPING:
+          chip.Mapping_write.push_back(transaction);
+          break;
+        case Transaction_Source_Type::GC_WL:
+          chip.GC_write.push_back(transaction);
+          break;
+        }
+        break;
+      case Transaction_Type::ERASE:
+        chip.GC_erase.push_back(transaction);
+        break;
+      default:
+        break;
+      }
+    }
+
+    for (flash_channel_ID_type channelID = 0; channelID < channel_count; channelID++)
+    {
+      if (_is_idle_channel(channelID))
+        _handle_idle_channel(channelID);
+    }
+  }
+
+  /// As in TSU_OutOfOrder, the transactions are dispatched only to the idle
+  /// chips, and the ongoing program and erase operations are not suspended.
+  bool TSU_FLIN::service_read_transaction(const NVM::FlashMemory::Flash_Chip& chip)
+  {
+    auto& queues = __chip_queues(chip);
+    Flash_Transaction_Queue *sourceQueue1 = nullptr, *sourceQueue2 = nullptr;
+
+    uint32_t next_read_turn;
+    auto* user_read = __arbitrate(queues.User_read, queues.Read_turn, next_read_turn);
+
+    if (!queues.Mapping_read.empty()) {
+      //Flash transactions that are related to FTL mapping data have the highest priority
+      sourceQueue1 = &queues.Mapping_read;
+
+      if (ftl.is_in_urgent_gc(&chip) && !queues.GC_read.empty())
+        sourceQueue2 = &queues.GC_read;
+      else
+        sourceQueue2 = user_read;
+    }
+    else if (ftl.is_in_urgent_gc(&chip)) {
+      if (!queues.GC_read.empty()) {
+        sourceQueue1 = &queues.GC_read;
+        sourceQueue2 = user_read;
+      }
+      else if (!queues.GC_write.empty() || !queues.GC_erase.empty())
+        return false;
+      else if (user_read != nullptr)
+        sourceQueue1 = user_read;
+      else return false;
+    }
+    else {
+      uint32_t next_write_turn;
+      auto* user_write = __arbitrate(queues.User_write, queues.Write_turn, next_write_turn);
+
+      if (user_read != nullptr) {
+        // Stage 3: the write candidate goes first if it waited longer with
+        // respect to its service time.
+        if (user_write != nullptr
+            && __proportional_wait(user_read->front()) < __proportional_wait(user_write->front()))
+          return false;
+
+        sourceQueue1 = user_read;
+        if (!queues.GC_read.empty())
+          sourceQueue2 = &queues.GC_read;
+      }
+      else if (user_write != nullptr)
+        return false;
+      else if (!queues.GC_read.empty())
+        sourceQueue1 = &queues.GC_read;
+      else return false;
+    }
+
+    if (_NVMController.GetChipStatus(chip) != ChipStatus::IDLE)
+      return false;
+
+    __dispatch(sourceQueue1, sourceQueue2, false);
+
+    if (user_read != nullptr && (sourceQueue1 == user_read || sourceQueue2 == user_read))
+      queues.Read_turn = next_read_turn;
+
+    return true;
+  }
+
+  bool TSU_FLIN::service_write_transaction(const NVM::FlashMemory::Flash_Chip& chip)
+  {
+    auto& queues = __chip_queues(chip);
+    Flash_Transaction_Queue *sourceQueue1 = nullptr, *sourceQueue2 = nullptr;
+
+    uint32_t next_write_turn;
+    auto* user_write = __arbitrate(queues.User_write, queues.Write_turn, next_write_turn);
+
+    if (ftl.is_in_urgent_gc(&chip)) {
+      if (!queues.GC_write.empty()) {
+        sourceQueue1 = &queues.GC_write;
+        sourceQueue2 = user_write;
+      }
+      else if (!queues.GC_erase.empty())
+        return false;
+      else if (user_write != nullptr)
+        sourceQueue1 = user_write;
+      else return false;
+    }
+    else {
+      if (user_write != nullptr) {
+        sourceQueue1 = user_write;
+        if (!queues.GC_write.empty())
+          sourceQueue2 = &queues.GC_write;
+      }
+      else if (!queues.GC_write.empty())
+        sourceQueue1 = &queues.GC_write;
+      else return false;
+    }
+
+    if (_NVMController.GetChipStatus(chip) != ChipStatus::IDLE)
+      return false;
+
+    __dispatch(sourceQueue1, sourceQueue2, true);
+
+    if (user_write != nullptr && (sourceQueue1 == user_write || sourceQueue2 == user_write))
+      queues.Write_turn = next_write_turn;
+
+    return true;
+  }
+
+  bool TSU_FLIN::service_erase_transaction(const NVM::FlashMemory::Flash_Chip& chip)
+  {
+    if (_NVMController.GetChipStatus(chip) != ChipStatus::IDLE)
+      return false;
+
+    auto& source_queue = __chip_queues(chip).GC_erase;
+    if (source_queue.empty())
+      return false;
+
+    flash_die_ID_type dieID = source_queue.front()->Address.DieID;
+    for (uint32_t i = 0; i < die_no_per_chip; i++)
+    {
+      uint32_t planeVector = 0;
+      transaction_dispatch_slots.clear();
+
+      for (auto it = source_queue.begin(); it != source_queue.end(); )
+      {
+        if (((NvmTransactionFlashER*)*it)->Page_movement_activities.empty() && (*it)->Address.DieID == dieID && !(planeVector & 1U << (*it)->Address.PlaneID))
+        {
+          planeVector |= 1U << (*it)->Address.PlaneID;
+          transaction_dispatch_slots.push_back(*it);
+          source_queue.remove(it++);
+          continue;
+        }
+        it++;
+      }
+
+      if (!transaction_dispatch_slots.empty())
+        _NVMController.Send_command_to_chip(transaction_dispatch_slots);
+      transaction_dispatch_slots.clear();
+      dieID = (dieID + 1) % die_no_per_chip;
+    }
+    return true;
+  }
+}
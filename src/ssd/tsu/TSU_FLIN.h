@@ -0,0 +1,158 @@
+#ifndef TSU_FLIN_H
+#define TSU_FLIN_H
+
+#include <vector>
+
+#include "../Flash_Transaction_Queue.h"
+#include "../NvmTransactionFlash.h"
+#include "../interface/Host_Interface_Defs.h"
+
+#include "TSU_Base.h"
+
+namespace SSD_Components
+{
+  class FTL;
+
+  /*
+   * This class implements the FLIN fairness-aware transaction scheduling unit
+   * described in "Tavakkol et al., FLIN: Enabling Fairness and Enhancing
+   * Performance in Modern NVMe Solid State Drives, ISCA 2018". Each chip has
+   * a read and a write queue per priority class, and the user transactions
+   * go through three stages:
+   * 1. Fairness-aware queue insertion. The flows are classified into low and
+   *    high intensity ones at every epoch by their arrivals at the chip. The
+   *    transactions of the low intensity flows are inserted ahead of the high
+   *    intensity ones, and the high intensity part is reordered to serve the
+   *    most slowed down flow first when the estimated fairness drops below the
+   *    fairness threshold.
+   * 2. Priority-aware queue arbitration. The URGENT class is always served
+   *    first, and the other classes are served in weighted round-robin.
+   * 3. Wait-balancing transaction selection. The read or write candidate with
+   *    the larger proportional wait, (waiting + service time) / service time,
+   *    is served first.
+   * The mapping and GC transactions are scheduled as in TSU_OutOfOrder.
+   */
+  class TSU_FLIN : public TSU_Base
+  {
+  private:
+    static constexpr uint32_t PRIORITY_CLASS_COUNT = 4;
+
+    struct ChipQueues {
+      Flash_Transaction_Queue User_read[PRIORITY_CLASS_COUNT];
+      Flash_Transaction_Queue User_write[PRIORITY_CLASS_COUNT];
+      Flash_Transaction_Queue Mapping_read;
+      Flash_Transaction_Queue Mapping_write;
+      Flash_Transaction_Queue GC_read;
+      Flash_Transaction_Queue GC_write;
+      Flash_Transaction_Queue GC_erase;
+
+      // Weighted round-robin turns of the priority-aware arbitration
+      uint32_t Read_turn;
+      uint32_t Write_turn;
+
+      // Arrivals of the flows at the chip in the current epoch, and the
+      // intensity classification of the last epoch
+      std::vector<uint32_t> Read_arrivals;
+      std::vector<uint32_t> Write_arrivals;
+      std::vector<bool>     High_intensity_read;
+      std::vector<bool>     High_intensity_write;
+
+      ChipQueues();
+    };
+
+    // Slowdown of a flow, estimated as the ratio of the turnaround times of
+    // its transactions in the shared and in the alone mode.
+    struct FlowStatistics {
+      IO_Flow_Priority_Class Priority_class;
+      uint64_t      Dispatched_transactions;
+      sim_time_type Shared_time;
+      sim_time_type Alone_time;
+
+      FlowStatistics();
+      double Slowdown() const;
+    };
+
+    const sim_time_type __flow_classification_epoch;
+    const uint32_t      __alpha_read;
+    const uint32_t      __alpha_write;
+    const double        __fairness_threshold;
+
+    const sim_time_type __read_service_time;
+    const sim_time_type __write_service_time;
+
+    std::vector<std::vector<ChipQueues>> __queues;
+    std::vector<FlowStatistics>          __flows;
+    sim_time_type                        __epoch_start;
+
+    // Scratch buffers of the fairness estimation
+    std::vector<sim_time_type>        __alone_wait;
+    std::vector<double>               __flow_slowdown;
+    std::vector<NvmTransactionFlash*> __moved;
+
+    ChipQueues& __chip_queues(const NVM::FlashMemory::Physical_Page_Address& address);
+    ChipQueues& __chip_queues(const NVM::FlashMemory::Flash_Chip& chip);
+
+    void __reserve_flow(ChipQueues& chip, stream_id_type stream_id);
+    void __update_epoch();
+    uint32_t __priority_index(NvmTransactionFlash* transaction);
+
+    sim_time_type __service_time(NvmTransactionFlash* transaction);
+    double __proportional_wait(NvmTransactionFlash* transaction);
+
+    void __insert_user_transaction(ChipQueues& chip, NvmTransactionFlash* transaction);
+    bool __is_high_intensity(const ChipQueues& chip, NvmTransactionFlash* transaction) const;
+    void __reorder_for_fairness(ChipQueues& chip, Flash_Transaction_Queue& queue, bool reorder);
+
+    Flash_Transaction_Queue* __arbitrate(Flash_Transaction_Queue* queues,
+                                         uint32_t turn,
+                                         uint32_t& next_turn);
+
+    void __gather(Flash_Transaction_Queue& queue,
+                  flash_die_ID_type die_id,
+                  flash_page_ID_type page_id,
+                  uint32_t& plane_vector,
+                  bool is_write);
+    void __dispatch(Flash_Transaction_Queue* source_queue1,
+                    Flash_Transaction_Queue* source_queue2,
+                    bool is_write);
+    void __account_dispatched(NvmTransactionFlash* transaction);
+
+  protected:
+    bool service_read_transaction(const NVM::FlashMemory::Flash_Chip& chip) final;
+    bool service_write_transaction(const NVM::FlashMemory::Flash_Chip& chip) final;
+    bool service_erase_transaction(const NVM::FlashMemory::Flash_Chip& chip) final;
+
+  public:
+    TSU_FLIN(const sim_object_id_type& id,
+             FTL& ftl,
+             NVM_PHY_ONFI& NVMController,
+             uint32_t Channel_no,
+             uint32_t chip_no_per_channel,
+             uint32_t DieNoPerChip,
+             uint32_t PlaneNoPerDie,
+             uint32_t stream_count,
+             sim_time_type flow_classification_epoch,
+             uint32_t alpha_read,
+             uint32_t alpha_write,
+             double fairness_threshold,
+             sim_time_type read_service_time,
+             sim_time_type write_service_time,
+             sim_time_type WriteReasonableSuspensionTimeForRead,
+             sim_time_type EraseReasonableSuspensionTimeForRead,
+             sim_time_type EraseReasonableSuspensionTimeForWrite,
+             bool EraseSuspensionEnabled,
+             bool ProgramSuspensionEnabled);
+
+    ~TSU_FLIN() final = default;
+    void Prepare_for_transaction_submit() final;
+    void Submit_transaction(NvmTransactionFlash* transaction) final;
+    void Schedule() final;
+
+    ChipQueueLengths Get_queue_lengths(flash_channel_ID_type channel_id,
+                                       flash_chip_ID_type chip_id) const final;
+
+    void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter) final;
+  };
+}
+
+#endif // TSU_FLIN_H
@@ -65,6 +65,22 @@ namespace SSD_Components
     delete[] MappingWriteTRQueue;
   }
 
+  ChipQueueLengths TSU_OutOfOrder::Get_queue_lengths(flash_channel_ID_type channel_id,
+                                                    flash_chip_ID_type chip_id) const
+  {
+    ChipQueueLengths lengths;
+
+    lengths.User_read = uint32_t(UserReadTRQueue[channel_id][chip_id].size());
+    lengths.User_write = uint32_t(UserWriteTRQueue[channel_id][chip_id].size());
+    lengths.Mapping = uint32_t(MappingReadTRQueue[channel_id][chip_id].size()
+                                 + MappingWriteTRQueue[channel_id][chip_id].size());
+    lengths.GC = uint32_t(GCReadTRQueue[channel_id][chip_id].size()
+                            + GCWriteTRQueue[channel_id][chip_id].size()
+                            + GCEraseTRQueue[channel_id][chip_id].size());
+
+    return lengths;
+  }
+
   void TSU_OutOfOrder::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
   {
     name_prefix = name_prefix + +".TSU";
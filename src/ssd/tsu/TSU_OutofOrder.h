@@ -55,6 +55,9 @@ namespace SSD_Components
     void Submit_transaction(NvmTransactionFlash* transaction) final;
     void Schedule() final;
 
+    ChipQueueLengths Get_queue_lengths(flash_channel_ID_type channel_id,
+                                       flash_chip_ID_type chip_id) const final;
+
     void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter) final;
 
   };
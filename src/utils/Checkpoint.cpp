@@ -0,0 +1,106 @@
+#include "Checkpoint.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <unistd.h>
+
+using namespace Utils;
+
+constexpr char CheckpointFormat::MAGIC[8];
+constexpr uint32_t CheckpointFormat::VERSION;
+
+/// ------------------
+/// Checkpoint writer
+/// ------------------
+CheckpointWriter::CheckpointWriter(const std::string& path)
+  : __path(path),
+    __temp_path(path + ".tmp." + std::to_string(::getpid()) + "."
+                + std::to_string(reinterpret_cast<uintptr_t>(this))),
+    __file(__temp_path, std::ios::out | std::ios::binary | std::ios::trunc),
+    __committed(false)
+{
+  if (!__file.is_open())
+    throw mqsim_error("Error while creating checkpoint file: " + __path);
+
+  write_bytes(CheckpointFormat::MAGIC, sizeof(CheckpointFormat::MAGIC));
+  write(CheckpointFormat::VERSION);
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+  if (!__committed) {
+    __file.close();
+    std::remove(__temp_path.c_str());
+  }
+}
+
+void
+CheckpointWriter::write_bytes(const void* data, size_t size)
+{
+  __file.write(static_cast<const char*>(data), std::streamsize(size));
+}
+
+void
+CheckpointWriter::write_section(const std::string& name)
+{
+  write<uint32_t>(name.size());
+  write_bytes(name.data(), name.size());
+}
+
+void
+CheckpointWriter::commit()
+{
+  __file.close();
+
+  if (!__file)
+    throw mqsim_error("Error while writing checkpoint file: " + __path);
+
+  if (std::rename(__temp_path.c_str(), __path.c_str()) != 0)
+    throw mqsim_error("Error while storing checkpoint file: " + __path
+                      + ": " + std::strerror(errno));
+
+  __committed = true;
+}
+
+/// ------------------
+/// Checkpoint reader
+/// ------------------
+CheckpointReader::CheckpointReader(const std::string& path)
+  : __path(path),
+    __file(path, std::ios::in | std::ios::binary)
+{
+  if (!__file.is_open())
+    throw mqsim_error("Error while opening checkpoint file: " + __path);
+
+  char magic[sizeof(CheckpointFormat::MAGIC)] = {};
+  __file.read(magic, sizeof(magic));
+
+  if (__file.gcount() != sizeof(magic)
+      || std::memcmp(magic, CheckpointFormat::MAGIC, sizeof(magic)) != 0)
+    throw mqsim_error("Invalid checkpoint file: " + __path);
+
+  if (read<uint32_t>() != CheckpointFormat::VERSION)
+    throw mqsim_error("Unsupported checkpoint file version: " + __path);
+}
+
+void
+CheckpointReader::read_bytes(void* data, size_t size)
+{
+  __file.read(static_cast<char*>(data), std::streamsize(size));
+
+  if (__file.gcount() != std::streamsize(size))
+    throw mqsim_error("Truncated checkpoint file: " + __path);
+}
+
+void
+CheckpointReader::read_section(const std::string& name)
+{
+  std::string stored(read<uint32_t>(), '\0');
+  read_bytes(&stored[0], stored.size());
+
+  if (stored != name)
+    throw mqsim_error("Corrupted checkpoint file: " + __path
+                      + " (expected section " + name + ", found " + stored + ")");
+}
@@ -0,0 +1,144 @@
+//
+// Checkpoint
+// MQSim
+//
+
+#ifndef __MQSim__Checkpoint__
+#define __MQSim__Checkpoint__
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Exception.h"
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Versioned binary checkpoint file. The file starts with the magic and the
+  // format version, and the rest is a sequence of named sections written and
+  // read in the same order. Values are stored in the host byte order, so a
+  // checkpoint is only portable between hosts of the same endianness.
+  // ------------------------------------------------------------------------
+  struct CheckpointFormat {
+    static constexpr char     MAGIC[8] = { 'M', 'Q', 'S', 'I', 'M', 'C', 'K', 'P' };
+    static constexpr uint32_t VERSION = 2;
+  };
+
+  // The writer stores the checkpoint into a temporary file next to the target
+  // and renames it on commit(), so the other scenarios running in parallel
+  // never see a partially written checkpoint.
+  class CheckpointWriter {
+  private:
+    const std::string __path;
+    const std::string __temp_path;
+
+    std::ofstream __file;
+    bool          __committed;
+
+  public:
+    explicit CheckpointWriter(const std::string& path);
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    void write_bytes(const void* data, size_t size);
+    void write_section(const std::string& name);
+
+    template <typename T>
+    void write(const T& value);
+
+    template <typename T>
+    void write_vector(const std::vector<T>& values);
+
+    // Throws mqsim_error if the checkpoint cannot be written.
+    void commit();
+  };
+
+  class CheckpointReader {
+  private:
+    const std::string __path;
+
+    std::ifstream __file;
+
+  public:
+    explicit CheckpointReader(const std::string& path);
+
+    void read_bytes(void* data, size_t size);
+    void read_section(const std::string& name);
+
+    template <typename T>
+    T read();
+
+    template <typename T>
+    void read_vector(std::vector<T>& values);
+
+    // Compares a configuration value of the running simulation with the
+    // checkpointed one, and throws mqsim_error on mismatch.
+    template <typename T>
+    void expect(const T& value, const std::string& what);
+  };
+
+  template <typename T>
+  force_inline void
+  CheckpointWriter::write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be checkpointed");
+
+    write_bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  force_inline void
+  CheckpointWriter::write_vector(const std::vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be checkpointed");
+
+    write<uint64_t>(values.size());
+    write_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  template <typename T>
+  force_inline T
+  CheckpointReader::read()
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be checkpointed");
+
+    T value;
+    read_bytes(&value, sizeof(T));
+
+    return value;
+  }
+
+  template <typename T>
+  force_inline void
+  CheckpointReader::read_vector(std::vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be checkpointed");
+
+    values.resize(read<uint64_t>());
+    read_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  template <typename T>
+  force_inline void
+  CheckpointReader::expect(const T& value, const std::string& what)
+  {
+    T stored = read<T>();
+
+    if (stored != value)
+      throw mqsim_error("Checkpoint " + __path + " does not match the current "
+                        "configuration (" + what + ": "
+                        + std::to_string(stored) + " in the checkpoint, "
+                        + std::to_string(value) + " in the configuration)");
+  }
+}
+
+#endif /* Predefined include guard __MQSim__Checkpoint__ */
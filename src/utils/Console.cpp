@@ -0,0 +1,37 @@
+#include "Console.h"
+
+#include <iostream>
+
+using namespace Utils;
+
+thread_local std::unique_ptr<std::ostringstream> Console::__buffer;
+std::mutex Console::__lock;
+
+std::ostream&
+Console::out()
+{
+  if (__buffer)
+    return *__buffer;
+
+  return std::cout;
+}
+
+void
+Console::begin_buffering()
+{
+  __buffer.reset(new std::ostringstream());
+}
+
+void
+Console::flush()
+{
+  if (!__buffer)
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(__lock);
+    std::cout << __buffer->str() << std::flush;
+  }
+
+  __buffer.reset();
+}
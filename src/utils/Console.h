@@ -0,0 +1,44 @@
+//
+// Console
+// MQSim
+//
+
+#ifndef __MQSim__Console__
+#define __MQSim__Console__
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Console output of the simulation. A scenario running on a worker thread
+  // writes into a buffer of its thread, and the buffer is printed as a whole
+  // when the scenario finishes, so the outputs of the scenarios running at
+  // the same time never interleave. The progress bars are skipped while
+  // buffering because nobody can watch them.
+  // ------------------------------------------------------------------------
+  class Console {
+  private:
+    static thread_local std::unique_ptr<std::ostringstream> __buffer;
+    static std::mutex __lock;
+
+  public:
+    static std::ostream& out();
+    static bool interactive();
+
+    static void begin_buffering();
+    static void flush();
+  };
+
+  force_inline bool
+  Console::interactive()
+  {
+    return !__buffer;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__Console__ */
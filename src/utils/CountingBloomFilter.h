@@ -0,0 +1,167 @@
+//
+// CountingBloomFilter
+// MQSim
+//
+
+#ifndef __MQSim__CountingBloomFilter__
+#define __MQSim__CountingBloomFilter__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Exception.h"
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Counting Bloom filter with 4 bit saturating counters.
+  //
+  // The filter is sized for the expected number of keys and the target false
+  // positive rate, so its memory does not depend on how many keys are really
+  // inserted. Sixteen counters are packed in a word, and decay() halves all
+  // of them at once. A key inserted once is forgotten by the next decay,
+  // while a counter shared by several keys fades out over a few decays.
+  // ------------------------------------------------------------------------
+  class CountingBloomFilter {
+  private:
+    static constexpr uint32_t COUNTER_BITS      = 4;
+    static constexpr uint32_t COUNTERS_PER_WORD = 64 / COUNTER_BITS;
+    static constexpr uint64_t COUNTER_MAX       = (1U << COUNTER_BITS) - 1;
+    static constexpr uint32_t MAX_HASH_COUNT    = 16;
+
+    // Every counter bit but the top one, to halve the counters in a word
+    static constexpr uint64_t HALVING_MASK = 0x7777777777777777ULL;
+
+    uint64_t              __counter_count;
+    uint32_t              __hash_count;
+    std::vector<uint64_t> __words;
+
+    static uint64_t __mix(uint64_t key);
+
+    uint64_t __counter(uint64_t index) const;
+    void __increase(uint64_t index);
+
+  public:
+    CountingBloomFilter(uint64_t capacity, double false_positive_rate);
+
+    bool contains(uint64_t key) const;
+    void insert(uint64_t key);
+
+    void decay();
+    void clear();
+
+    uint32_t hash_count() const;
+    uint64_t size_in_bytes() const;
+  };
+
+  force_inline
+  CountingBloomFilter::CountingBloomFilter(uint64_t capacity,
+                                           double false_positive_rate)
+    : __counter_count(0),
+      __hash_count(0),
+      __words()
+  {
+    if (capacity == 0)
+      throw mqsim_error("Counting Bloom filter capacity should be positive");
+
+    if (false_positive_rate <= 0 || 1 <= false_positive_rate)
+      throw mqsim_error("Counting Bloom filter false positive rate should be "
+                        "between 0 and 1");
+
+    // Optimal sizes: m = -n ln(p) / ln(2)^2 and k = m / n ln(2)
+    double counters = -double(capacity) * std::log(false_positive_rate)
+                        / (M_LN2 * M_LN2);
+
+    __counter_count = std::max(uint64_t(std::ceil(counters)),
+                               uint64_t(COUNTERS_PER_WORD));
+    __hash_count = uint32_t(std::lround(counters / double(capacity) * M_LN2));
+    __hash_count = std::min(std::max(__hash_count, 1U), MAX_HASH_COUNT);
+
+    __words.assign((__counter_count + COUNTERS_PER_WORD - 1) / COUNTERS_PER_WORD,
+                   0);
+  }
+
+  force_inline uint64_t
+  CountingBloomFilter::__mix(uint64_t key)
+  {
+    // SplitMix64 finalizer
+    key = (key ^ (key >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27U)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31U);
+  }
+
+  force_inline uint64_t
+  CountingBloomFilter::__counter(uint64_t index) const
+  {
+    uint32_t shift = uint32_t(index % COUNTERS_PER_WORD) * COUNTER_BITS;
+
+    return (__words[index / COUNTERS_PER_WORD] >> shift) & COUNTER_MAX;
+  }
+
+  force_inline void
+  CountingBloomFilter::__increase(uint64_t index)
+  {
+    uint32_t shift = uint32_t(index % COUNTERS_PER_WORD) * COUNTER_BITS;
+    uint64_t& word = __words[index / COUNTERS_PER_WORD];
+
+    if (((word >> shift) & COUNTER_MAX) != COUNTER_MAX)
+      word += uint64_t(1) << shift;
+  }
+
+  force_inline bool
+  CountingBloomFilter::contains(uint64_t key) const
+  {
+    // Double hashing (Kirsch and Mitzenmacher) from the two halves of the
+    // mixed key.
+    uint64_t hash = __mix(key);
+    uint64_t h1 = hash & UINT32_MAX;
+    uint64_t h2 = (hash >> 32U) | 1U;
+
+    for (uint32_t i = 0; i < __hash_count; ++i) {
+      if (!__counter((h1 + i * h2) % __counter_count))
+        return false;
+    }
+
+    return true;
+  }
+
+  force_inline void
+  CountingBloomFilter::insert(uint64_t key)
+  {
+    uint64_t hash = __mix(key);
+    uint64_t h1 = hash & UINT32_MAX;
+    uint64_t h2 = (hash >> 32U) | 1U;
+
+    for (uint32_t i = 0; i < __hash_count; ++i)
+      __increase((h1 + i * h2) % __counter_count);
+  }
+
+  force_inline void
+  CountingBloomFilter::decay()
+  {
+    for (auto& word : __words)
+      word = (word >> 1U) & HALVING_MASK;
+  }
+
+  force_inline void
+  CountingBloomFilter::clear()
+  {
+    std::fill(__words.begin(), __words.end(), 0);
+  }
+
+  force_inline uint32_t
+  CountingBloomFilter::hash_count() const
+  {
+    return __hash_count;
+  }
+
+  force_inline uint64_t
+  CountingBloomFilter::size_in_bytes() const
+  {
+    return __words.size() * sizeof(uint64_t);
+  }
+}
+
+#endif /* Predefined include guard __MQSim__CountingBloomFilter__ */
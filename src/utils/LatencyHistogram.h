@@ -0,0 +1,222 @@
+//
+// LatencyHistogram
+// MQSim
+//
+
+#ifndef __MQSim__LatencyHistogram__
+#define __MQSim__LatencyHistogram__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../sim/Sim_Defs.h"
+#include "CountingStats.h"
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Log-linear (HDR style) latency histogram.
+  //
+  // Values below 2^SUB_BUCKET_BITS are counted exactly. Each larger power of
+  // two range is split into 2^(SUB_BUCKET_BITS - 1) linear buckets, so a
+  // reported value is within 1/128 of the recorded one. The bucket array has
+  // a fixed size, and a value is recorded with a few shifts. Values over the
+  // trackable range are counted in the last bucket, but the min, max and
+  // average are kept exactly.
+  // ------------------------------------------------------------------------
+  class LatencyHistogram {
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 8;
+    static constexpr uint32_t MAX_VALUE_BITS  = 40;  // about 18 minutes
+
+    static constexpr uint32_t SUB_BUCKET_HALF = 1U << (SUB_BUCKET_BITS - 1);
+    static constexpr uint32_t BUCKET_COUNT
+      = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 2) * SUB_BUCKET_HALF;
+
+  private:
+    static constexpr sim_time_type MAX_TRACKABLE
+      = (sim_time_type(1) << MAX_VALUE_BITS) - 1;
+
+    MinMaxAvgStats<sim_time_type> __stats;
+    std::vector<uint64_t>         __buckets;
+
+    static uint32_t __index_of(sim_time_type value);
+    static uint32_t __shift_of(uint32_t index);
+
+  public:
+    LatencyHistogram();
+
+    // Lowest and highest values counted in the bucket of the index.
+    static sim_time_type Lowest_value(uint32_t index);
+    static sim_time_type Highest_value(uint32_t index);
+
+    uint64_t count() const;
+    sim_time_type min(sim_time_type scale = 1) const;
+    sim_time_type max(sim_time_type scale = 1) const;
+    sim_time_type avg(sim_time_type scale = 1) const;
+
+    // Nearest rank percentile (0 < percentile <= 100). The highest value of
+    // the bucket holding the rank is reported, bounded by the exact max.
+    sim_time_type percentile(double percentile, sim_time_type scale = 1) const;
+
+    // Non empty buckets as "<highest value>:<count>" pairs separated by a
+    // space. It is enough to rebuild the histogram for merging.
+    std::string to_string() const;
+
+    void reset();
+
+    // Merge two histograms, i.e. of several flows or several runs.
+    LatencyHistogram operator+(const LatencyHistogram& rhs) const;
+    LatencyHistogram& operator+=(const LatencyHistogram& rhs);
+
+    // For counting up
+    LatencyHistogram& operator+=(const sim_time_type& value);
+  };
+
+  force_inline
+  LatencyHistogram::LatencyHistogram()
+    : __stats(MAXIMUM_TIME, 0),
+      __buckets(BUCKET_COUNT, 0)
+  { }
+
+  force_inline uint32_t
+  LatencyHistogram::__index_of(sim_time_type value)
+  {
+    value = std::min(value, MAX_TRACKABLE);
+
+    uint32_t shift = 0;
+
+    if (value >> SUB_BUCKET_BITS)
+      shift = 64U - uint32_t(__builtin_clzll(value)) - SUB_BUCKET_BITS;
+
+    return (shift << (SUB_BUCKET_BITS - 1)) + uint32_t(value >> shift);
+  }
+
+  force_inline uint32_t
+  LatencyHistogram::__shift_of(uint32_t index)
+  {
+    return index < 2 * SUB_BUCKET_HALF
+             ? 0
+             : (index >> (SUB_BUCKET_BITS - 1)) - 1;
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::Lowest_value(uint32_t index)
+  {
+    uint32_t shift = __shift_of(index);
+
+    return sim_time_type(index - (shift << (SUB_BUCKET_BITS - 1))) << shift;
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::Highest_value(uint32_t index)
+  {
+    return Lowest_value(index) + (sim_time_type(1) << __shift_of(index)) - 1;
+  }
+
+  force_inline uint64_t
+  LatencyHistogram::count() const
+  {
+    return __stats.count();
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::min(sim_time_type scale) const
+  {
+    return count() ? __stats.min(scale) : 0;
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::max(sim_time_type scale) const
+  {
+    return __stats.max(scale);
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::avg(sim_time_type scale) const
+  {
+    return __stats.avg(scale);
+  }
+
+  force_inline sim_time_type
+  LatencyHistogram::percentile(double percentile, sim_time_type scale) const
+  {
+    if (!count())
+      return 0;
+
+    auto rank = uint64_t(std::ceil(percentile / 100 * double(count())));
+    rank = std::min(std::max(rank, uint64_t(1)), count());
+
+    uint64_t seen = 0;
+
+    for (uint32_t index = 0; index < BUCKET_COUNT; ++index) {
+      seen += __buckets[index];
+
+      if (rank <= seen)
+        return std::min(Highest_value(index), __stats.max()) / scale;
+    }
+
+    return __stats.max(scale);
+  }
+
+  force_inline std::string
+  LatencyHistogram::to_string() const
+  {
+    std::string out;
+
+    for (uint32_t index = 0; index < BUCKET_COUNT; ++index) {
+      if (!__buckets[index])
+        continue;
+
+      if (!out.empty())
+        out += ' ';
+
+      out += std::to_string(Highest_value(index)) + ':'
+               + std::to_string(__buckets[index]);
+    }
+
+    return out;
+  }
+
+  force_inline void
+  LatencyHistogram::reset()
+  {
+    __stats = MinMaxAvgStats<sim_time_type>(MAXIMUM_TIME, 0);
+    std::fill(__buckets.begin(), __buckets.end(), 0);
+  }
+
+  force_inline LatencyHistogram
+  LatencyHistogram::operator+(const LatencyHistogram& rhs) const
+  {
+    LatencyHistogram v = *this;
+
+    v += rhs;
+
+    return v;
+  }
+
+  force_inline LatencyHistogram&
+  LatencyHistogram::operator+=(const LatencyHistogram& rhs)
+  {
+    __stats = __stats + rhs.__stats;
+
+    for (uint32_t index = 0; index < BUCKET_COUNT; ++index)
+      __buckets[index] += rhs.__buckets[index];
+
+    return *this;
+  }
+
+  force_inline LatencyHistogram&
+  LatencyHistogram::operator+=(const sim_time_type& value)
+  {
+    __stats += value;
+    ++__buckets[__index_of(value)];
+
+    return *this;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__LatencyHistogram__ */
@@ -0,0 +1,90 @@
+#include "MappedBuffer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Exception.h"
+
+using namespace Utils;
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
+MappedBuffer::MappedBuffer()
+  : __fd(-1),
+    __data(nullptr),
+    __size(0)
+{ }
+
+MappedBuffer::~MappedBuffer()
+{
+  release();
+}
+
+void
+MappedBuffer::allocate(size_t size, const std::string& backing_dir)
+{
+  release();
+
+  if (size == 0)
+    return;
+
+  void* addr;
+
+  if (backing_dir.empty()) {
+    addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  } else {
+    std::string pattern = backing_dir + "/mqsim-XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+
+    __fd = ::mkstemp(path.data());
+
+    if (__fd == -1)
+      throw mqsim_error("Cannot create a backing file in " + backing_dir
+                        + ": " + std::strerror(errno));
+
+    // The file is removed when the mapping is released.
+    ::unlink(path.data());
+
+    if (::ftruncate(__fd, off_t(size)) != 0) {
+      int error = errno;
+      release();
+      throw mqsim_error("Cannot resize the backing file in " + backing_dir
+                        + ": " + std::strerror(error));
+    }
+
+    addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0);
+  }
+
+  if (addr == MAP_FAILED) {
+    int error = errno;
+    release();
+    throw mqsim_error("Cannot map " + std::to_string(size) + " bytes: "
+                      + std::strerror(error));
+  }
+
+  __data = static_cast<char*>(addr);
+  __size = size;
+}
+
+void
+MappedBuffer::release()
+{
+  if (__data != nullptr)
+    ::munmap(__data, __size);
+
+  if (__fd != -1)
+    ::close(__fd);
+
+  __fd = -1;
+  __data = nullptr;
+  __size = 0;
+}
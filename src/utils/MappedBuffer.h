@@ -0,0 +1,62 @@
+//
+// MappedBuffer
+// MQSim
+//
+
+#ifndef __MQSim__MappedBuffer__
+#define __MQSim__MappedBuffer__
+
+#include <cstddef>
+#include <string>
+
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Zero-filled writable memory region whose pages are allocated on the
+  // first write. The region is mapped from the anonymous memory, or from an
+  // unlinked sparse file in the backing directory to keep huge tables out of
+  // the host RAM and the swap space.
+  // ------------------------------------------------------------------------
+  class MappedBuffer {
+  private:
+    int    __fd;
+    char*  __data;
+    size_t __size;
+
+  public:
+    MappedBuffer();
+    ~MappedBuffer();
+
+    MappedBuffer(const MappedBuffer&) = delete;
+    MappedBuffer& operator=(const MappedBuffer&) = delete;
+
+    // Throws mqsim_error if the region cannot be mapped.
+    void allocate(size_t size, const std::string& backing_dir = "");
+    void release();
+
+    char* data();
+    const char* data() const;
+    size_t size() const;
+  };
+
+  force_inline char*
+  MappedBuffer::data()
+  {
+    return __data;
+  }
+
+  force_inline const char*
+  MappedBuffer::data() const
+  {
+    return __data;
+  }
+
+  force_inline size_t
+  MappedBuffer::size() const
+  {
+    return __size;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__MappedBuffer__ */
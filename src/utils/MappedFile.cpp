@@ -0,0 +1,75 @@
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Utils;
+
+MappedFile::MappedFile()
+  : __fd(-1),
+    __data(nullptr),
+    __size(0)
+{ }
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool
+MappedFile::open(const std::string& path)
+{
+  close();
+
+  __fd = ::open(path.c_str(), O_RDONLY);
+
+  if (__fd == -1)
+    return false;
+
+  struct stat file_stat{};
+
+  if (::fstat(__fd, &file_stat) != 0) {
+    close();
+    return false;
+  }
+
+  __size = size_t(file_stat.st_size);
+
+  // Zero-length file cannot be mapped, but it is still a valid empty file.
+  if (__size == 0)
+    return true;
+
+  void* addr = ::mmap(nullptr, __size, PROT_READ, MAP_PRIVATE, __fd, 0);
+
+  if (addr == MAP_FAILED) {
+    close();
+    return false;
+  }
+
+  __data = static_cast<char*>(addr);
+
+  return true;
+}
+
+void
+MappedFile::close()
+{
+  if (__data != nullptr)
+    ::munmap(__data, __size);
+
+  if (__fd != -1)
+    ::close(__fd);
+
+  __fd = -1;
+  __data = nullptr;
+  __size = 0;
+}
+
+void
+MappedFile::advise_sequential() const
+{
+  if (__data != nullptr)
+    ::madvise(__data, __size, MADV_SEQUENTIAL);
+}
@@ -0,0 +1,72 @@
+//
+// MappedFile
+// MQSim
+//
+
+#ifndef __MQSim__MappedFile__
+#define __MQSim__MappedFile__
+
+#include <cstddef>
+#include <string>
+
+#include "InlineTools.h"
+
+namespace Utils {
+  // ------------------------------------------------------------------------
+  // Read-only memory mapping of a whole file. Large input files (e.g. traces
+  // of hundreds of GB) are paged in by the kernel on demand instead of being
+  // copied through the stream buffers.
+  // ------------------------------------------------------------------------
+  class MappedFile {
+  private:
+    int    __fd;
+    char*  __data;
+    size_t __size;
+
+  public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    // Hint the kernel that the mapping will be read from the begin to the
+    // end, so it can read ahead aggressively and drop the consumed pages.
+    void advise_sequential() const;
+
+    bool is_open() const;
+
+    const char* begin() const;
+    const char* end() const;
+    size_t size() const;
+  };
+
+  force_inline bool
+  MappedFile::is_open() const
+  {
+    return __fd != -1;
+  }
+
+  force_inline const char*
+  MappedFile::begin() const
+  {
+    return __data;
+  }
+
+  force_inline const char*
+  MappedFile::end() const
+  {
+    return __data + __size;
+  }
+
+  force_inline size_t
+  MappedFile::size() const
+  {
+    return __size;
+  }
+}
+
+#endif /* Predefined include guard __MQSim__MappedFile__ */
@@ -18,6 +18,9 @@
 namespace Utils {
   class ObjectPoolBase;
 
+  template <class T>
+  class ObjectPool;
+
   // ----------------------------
   // Definition of ObjectItemBase
   // ----------------------------
@@ -81,12 +84,7 @@ namespace Utils {
   // ------------------------
   template <class T>
   class ObjectItem : public T, public ObjectItemBase {
-    friend class std::allocator< Utils::ObjectItem<T> >;
-    
-    // for the linux based working environments
-#ifdef linux
-    friend class __gnu_cxx::new_allocator< Utils::ObjectItem<T> >;
-#endif
+    friend class ObjectPool<T>;
 
   protected:
     template <typename... _Args>
@@ -280,7 +278,7 @@ namespace Utils {
                      ? static_cast<item_t*>(_get_free())
                      :  __allocator.allocate(1);
 
-    __allocator.construct(object, this, args...);
+    new (object) item_t(this, args...);
 
     _make_in_use(object);
 
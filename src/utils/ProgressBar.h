@@ -12,6 +12,7 @@
 #include <iostream>
 #include <string>
 
+#include "Console.h"
 #include "InlineTools.h"
 
 namespace Utils {
@@ -41,7 +42,7 @@ namespace Utils {
   force_inline void
   ProgressBar::update(int progress)
   {
-    if (progress >= __announcing_at) {
+    if (progress >= __announcing_at && Console::interactive()) {
       char bar[BAR_SIZE];
       char* pos = bar;
 
@@ -78,7 +78,7 @@ namespace Utils
     stream_id_type Stream_id;
     double Initial_occupancy_ratio;//Ratio of the logical storage space that is fill with data in steady-state
     uint32_t Replay_no;
-    uint32_t Total_generated_reqeusts;
+    uint64_t Total_generated_reqeusts;
 
     int random_request_type_generator_seed;
     double Read_ratio;
@@ -86,7 +86,7 @@ namespace Utils
 
     Utils::Address_Distribution_Type Address_distribution_type;
     double Working_set_ratio;
-    uint32_t Total_accessed_lbas;
+    uint64_t Total_accessed_lbas;
     /*Rosenblum hot/cold model: 
     - M. Rosenblum and J. K. Ousterhout, "The design and implementation of a log-structured file system", ACM CSUR, 1992.
     A fraction f of the complete address space corresponds to hot data and the remaining fraction to cold data. The fraction